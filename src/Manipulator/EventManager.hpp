@@ -28,6 +28,22 @@ namespace flm
 			RE::BSEventNotifyControl ProcessEvent(const SKSE::ModCallbackEvent* aEvent, RE::BSTEventSource<SKSE::ModCallbackEvent>*) override;
 
 		private:
+			/**
+			 * \brief Applies the Mod Event or its Undo and reports the result. Forms from configs must be added already.
+			 * \param eventName             - Name of the received event.
+			 * \param strArg                - String sent with the event.
+			 * \param numArg                - Value sent with the event.
+			 */
+			void handle(std::string_view eventName, std::string_view strArg, float numArg);
+
+			/**
+			 * \brief Sends the mod event that reports the result of a received event.
+			 * \param eventName             - Name of the sent event.
+			 * \param payload               - String sent with the event.
+			 * \param value                 - Value sent with the event.
+			 */
+			static void sendResult(const std::string& eventName, const std::string& payload, int value);
+
 			EventManager(const EventManager&) = delete;
 			EventManager(EventManager&&) = delete;
 			EventManager& operator=(const EventManager&) = delete;
@@ -36,33 +52,95 @@ namespace flm
 
 	inline RE::BSEventNotifyControl EventManager::ProcessEvent(const SKSE::ModCallbackEvent* aEvent, RE::BSTEventSource<SKSE::ModCallbackEvent>*)
 	{
-		if(auto event_name = aEvent->eventName.c_str(); aEvent && manipulator.GetModEvents().contains(event_name))
-		{
-			logger::info("Got event: {}, strArg: {}, numArg: {}.", event_name, aEvent->strArg, aEvent->numArg);
-			auto [added, duplicates] = AddGeneric(manipulator.GetModEvents()[event_name]);
-
-			const auto sent_event_name = fmt::format("{}OK", event_name);
-			const SKSE::ModCallbackEvent mod_event{
-				sent_event_name,
-				RE::BSFixedString(fmt::format("{}|{}|{}", event_name, added, duplicates)),
-				static_cast<float>(added),
-				nullptr
-			};
-
-			SKSE::GetModCallbackEventSource()->SendEvent(&mod_event);
-			logger::info("Sent event: {}.", sent_event_name);
-		}
-		else if(aEvent && kid && aEvent->eventName == "KID_KeywordDistributionDone")
+		if(!aEvent)
+			return RE::BSEventNotifyControl::kContinue;
+
+		const std::string_view event_name(aEvent->eventName.c_str());
+		if(kid && event_name == "KID_KeywordDistributionDone"sv)
 		{
 			logger::info("Starting FLM distribution since KID is done...");
 
-			manipulator.FindAll();
-			manipulator.AddAll();
-            manipulator.SendEventDone();
+			// Forms are added and FLM_SetupDone is sent outside of the event sink.
+			SKSE::GetTaskInterface()->AddTask([]
+											  { manipulator.Distribute(); });
+			return RE::BSEventNotifyControl::kContinue;
 		}
 
+		// Only events handled by FLM wait, and only until configs are read.
+		if(!manipulator.HandlesEvent(event_name))
+			return RE::BSEventNotifyControl::kContinue;
+
+		// Forms from configs are added outside of the event sink, the event is handled after them.
+		if(!manipulator.Ready())
+		{
+			SKSE::GetTaskInterface()->AddTask([this, name = std::string(event_name), str_arg = std::string(aEvent->strArg.c_str()), num_arg = aEvent->numArg]
+											  {
+												  manipulator.WaitReady();
+												  handle(name, str_arg, num_arg);
+											  });
+			return RE::BSEventNotifyControl::kContinue;
+		}
+
+		handle(event_name, aEvent->strArg.c_str(), aEvent->numArg);
 		return RE::BSEventNotifyControl::kContinue;
 	}
 
+	inline void EventManager::handle(const std::string_view eventName, const std::string_view strArg, const float numArg)
+	{
+		const auto additions = manipulator.GetModEvents().find(eventName);
+		const auto removals = manipulator.GetModEventRemovals().find(eventName);
+		if(additions != manipulator.GetModEvents().end() || removals != manipulator.GetModEventRemovals().end())
+		{
+			logger::info("Got event: {}, strArg: {}, numArg: {}.", eventName, strArg, numArg);
+			int added = 0;
+			int duplicates = 0;
+			int removed = 0;
+			// Only additions are recorded as a transaction, Undo removes them and does not add back Forms removed by the event.
+			if(additions != manipulator.GetModEvents().end())
+			{
+				InsertionLog transaction;
+				std::tie(added, duplicates) = AddGeneric(additions->second, &transaction);
+				manipulator.GetSavedInsertions().Append(transaction);
+				if(removals != manipulator.GetModEventRemovals().end())
+					removed = RemoveGeneric(removals->second, { &manipulator.GetSavedInsertions(), &transaction }).first;
+				// An application of only duplicates is not recorded, so Undo still reverts the last application that added Forms.
+				manipulator.GetTransactions().Commit(eventName, std::move(transaction));
+			}
+			else if(removals != manipulator.GetModEventRemovals().end())
+				removed = RemoveGeneric(removals->second, { &manipulator.GetSavedInsertions() }).first;
+
+			sendResult(fmt::format("{}OK", eventName), fmt::format("{}|{}|{}", eventName, added, duplicates), added);
+
+			// Removals are reported with a separate event, so the payload of EventNameOK keeps its format.
+			if(removals != manipulator.GetModEventRemovals().end())
+				sendResult(fmt::format("{}RemoveOK", eventName), fmt::format("{}|{}", eventName, removed), removed);
+		}
+		else if(eventName.ends_with(undo_suffix) && manipulator.HasModEvent(eventName.substr(0, eventName.size() - undo_suffix.size())))
+		{
+			logger::info("Got event: {}, strArg: {}, numArg: {}.", eventName, strArg, numArg);
+			const auto undone_event = eventName.substr(0, eventName.size() - undo_suffix.size());
+			const int removed = manipulator.GetTransactions().Undo(undone_event, { &manipulator.GetSavedInsertions() });
+			if(removed < 0)
+				logger::info("Mod Event {} has nothing to undo.", undone_event);
+			else
+				logger::info("Last application of Mod Event {} undone, {} Forms removed.", undone_event, removed);
+
+			sendResult(fmt::format("{}OK", eventName), fmt::format("{}|{}", eventName, std::max(removed, 0)), std::max(removed, 0));
+		}
+	}
+
+	inline void EventManager::sendResult(const std::string& eventName, const std::string& payload, const int value)
+	{
+		const SKSE::ModCallbackEvent mod_event{
+			eventName,
+			RE::BSFixedString(payload),
+			static_cast<float>(value),
+			nullptr
+		};
+
+		SKSE::GetModCallbackEventSource()->SendEvent(&mod_event);
+		logger::info("Sent event: {}.", eventName);
+	}
+
 	inline EventManager event_manager; /* Manages sending and receiving mod events. */
 }
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "Utility/FormResolver.hpp"
 #include "Utility/Types/FormType.hpp"
+#include "Utility/Types/SymbolTable.hpp"
 #include "Utility/Types/Types.hpp"
 #include "Utility/Utility.hpp"
 
@@ -22,12 +24,84 @@ namespace flm
 			 */
 			void AddAll();
 
+			/**
+			 * \brief Finds and adds all Forms from config files, then informs other mods that FLM has completed its work.
+			 * In asynchronous mode, configs are processed on a background thread and only adding Forms is passed back to the main thread.
+			 */
+			void Distribute();
+
+			/**
+			 * \brief Waits until the started distribution has processed configs and adds Forms from them, if they are not added yet.
+			 * Must be called on the main thread before FormLists are synchronized or Mod Events are used.
+			 */
+			void WaitReady();
+
+			/**
+			 * \brief Waits until the started distribution has processed configs, without adding Forms. Can be called on any thread.
+			 */
+			void WaitFound() const;
+
+			/**
+			 * \brief Checks whether Forms from configs were added, so Mod Events can be applied right away.
+			 * \return                      - True, if Forms from configs were added.
+			 */
+			[[nodiscard]] bool Ready() const;
+
+			/**
+			 * \brief Checks whether the event is a Mod Event from configs or its Undo. Waits only until configs are read, not until they are processed.
+			 * \param name                  - Name of the event.
+			 * \return                      - True, if FLM handles the event.
+			 */
+			[[nodiscard]] bool HandlesEvent(std::string_view name) const;
+
 			/**
 			 * \brief Returns manager for Mod Events.
 			 * \return Manager for Mod Events.
 			 */
 			MapModEvents& GetModEvents();
 
+			/**
+			 * \brief Returns Forms removed by Mod Events.
+			 * \return Forms removed by Mod Events.
+			 */
+			MapModEvents& GetModEventRemovals();
+
+			/**
+			 * \brief Checks whether the Mod Event adds or removes Forms.
+			 * \param name                  - Name of the Mod Event.
+			 * \return                      - True, if the Mod Event exists.
+			 */
+			[[nodiscard]] bool HasModEvent(std::string_view name) const;
+
+			/**
+			 * \brief Returns transactions of Mod Events applied in the current game.
+			 * \return Transactions of Mod Events.
+			 */
+			TransactionLog& GetTransactions();
+
+			/**
+			 * \brief Returns Forms inserted in the current game, read from the cosave and added by Mod Events.
+			 * \return Forms inserted in the current game.
+			 */
+			InsertionLog& GetSavedInsertions();
+
+			/**
+			 * \brief Writes Forms inserted by FLM to the cosave.
+			 * \param serialization         - SKSE serialization interface.
+			 */
+			void Save(const SKSE::SerializationInterface* serialization) const;
+
+			/**
+			 * \brief Reads Forms inserted by FLM from the cosave. They are restored after the game is loaded.
+			 * \param serialization         - SKSE serialization interface.
+			 */
+			void Load(const SKSE::SerializationInterface* serialization);
+
+			/**
+			 * \brief Forgets Forms inserted in the current game, before a new game starts or another save is loaded.
+			 */
+			void Revert();
+
 			/**
 			 * \brief Sending a mod event to inform other mods that the FLM has completed its work.
 			 */
@@ -36,42 +110,81 @@ namespace flm
 		private:
 			std::array<int, ift::ALL> infos_{}; /* Store values for types of countable statistics.*/
 			FormsLists lists_;                  /* FormLists from Skyrim for use in simplified entries. */
+			FormResolver resolver_{ infos_ };   /* Resolves Form references from configs. */
+
+			using ParseEntry = bool (Manipulator::*)(const Sections&); /* Member function that parses the entry sections. */
 
-			const std::array<ParseEntryCallback, EntryType::ALL> add_callbacks_{
-				std::bind(&Manipulator::parseAlias, this, std::placeholders::_1),                    /* Aliases for FormLists. */
-				std::bind(&Manipulator::parseGroup, this, std::placeholders::_1),                    /* Groups for Forms. */
-				std::bind(&Manipulator::parseCollection, this, std::placeholders::_1),               /* Collections for Forms with specific keyword. */
-				std::bind(&Manipulator::parseFilter, this, std::placeholders::_1),                   /* Filters for Entries. */
-				std::bind(&Manipulator::parseModEvent, this, std::placeholders::_1),                 /* Mod events. */
-				std::bind(&Manipulator::parseFormList, this, std::placeholders::_1),                 /* FromList. */
-				std::bind(&Manipulator::parsePlant, this, std::placeholders::_1),                    /* Plant. */
-				std::bind(&Manipulator::parseBToys, this, std::placeholders::_1),                    /* Boy's toys. */
-				std::bind(&Manipulator::parseGToys, this, std::placeholders::_1),                    /* Girl's toys. */
-				std::bind(&Manipulator::parseHairColors, this, std::placeholders::_1),               /* Hair colors. */
-				std::bind(&Manipulator::parseAtronachForge, this, std::placeholders::_1),            /* Atronach forge. */
-				std::bind(&Manipulator::parseAtronachForgeSigil, this, std::placeholders::_1),       /* Atronach forge with Sigil Stone. */
-				std::bind(&Manipulator::parseDragonbornSpiderCrafting, this, std::placeholders::_1), /* Dragonborn Spider Crafting. */
-			};                                                                                       /* Functions used to parse entries. */
-
-			StringMap<FormsLists> aliases_;     /* All valid Aliases. */
-			MapForms groups_;                   /* All valid Groups. Share names with Collections. */
-			MapForms collections_;              /* All valid Collections. Share names with Groups. */
-			MapModEvents mod_events_;           /* All valid Forms with ModEvents. */
-			StringMap<bool> filters_;           /* All valid Filters. */
-			FormListsData form_lists_;          /* All valid Forms for FormLists. */
-			FormsPairs plants_;                 /* All valid Forms with seeds and plants. */
-			Forms boy_toys_;                    /* All valid Forms with boy's toys. */
-			Forms girl_toys_;                   /* All valid Forms with girl's toys. */
-			Forms hair_colors_;                 /* All valid Forms with hair colors. */
-			FormsPairs atronach_forge_;         /* All valid Forms with recipes and results for Atronach Forge. */
-			FormsPairs atronach_sigil_forge_;   /* All valid Forms with recipes and results for Atronach Forge with Sigil. */
-			FormsPairs dragon_spider_crafting_; /* All valid Forms with recipes and results for Dragonborn Spider Crafting. */
-			CollectionData collections_data_;   /* All valid data for Collections. */
-			MapKeywords keywords_cache_;        /* All valid keywords. */
-
-			/* All valid Collections names for FormTypes. */
-			StringMapSet collections_form_types_;
+			/**
+			 * \brief Entry for a FormList from Skyrim whose use is simplified. Forms are added to one FormList, or pairs to two parallel FormLists.
+			 */
+			struct SimplifiedEntry
+			{
+				std::string_view header;                    /* Header of Forms that are added. */
+				PairEntryNames names;                       /* Names of: the entry, first element, second element. Second element only for pairs. */
+				FltPair lists;                              /* FormLists where Forms are added, second only for pairs. */
+				InfoTPair infos;                            /* Statistics that count added and duplicated Forms. */
+				Forms Manipulator::*forms = nullptr;        /* Forms to add, nullptr for pairs. */
+				FormIdPairs Manipulator::*pairs = nullptr;  /* Pairs to add, nullptr for Forms. */
+				bool plant_types_warn = false;              /* If True, checks pair form types for seed and plant. */
+			};
+
+			static constexpr int simplified_first = EntryType::PLANT; /* First type of entry whose use is simplified, all later types are simplified too. */
+
+			static const std::array<ParseEntry, simplified_first> parsers_;                                     /* Functions used to parse entries, by type. */
+			static const std::array<SimplifiedEntry, EntryType::ALL - simplified_first> simplified_entries_; /* Entries whose use is simplified, by type, in order they are added. */
+
+			SymbolTable symbols_;                           /* Names of Aliases, Groups, Collections and Filters. */
+			SymbolMap<Definition> alias_definitions_;       /* Definitions of Aliases, valid only while configs are processed. */
+			SymbolMap<Definition> group_definitions_;       /* Definitions of Groups, valid only while configs are processed. */
+			SymbolMap<FormsLists> aliases_;                 /* All valid resolved Aliases. */
+			SymbolMap<SharedForms> groups_;                 /* All valid resolved Groups. Share names with Collections. */
+			SymbolMap<std::shared_ptr<Forms>> collections_; /* All valid Collections. Share names with Groups. */
+			MapModEvents mod_events_;                       /* All valid Forms with ModEvents. */
+			MapModEventsSets mod_event_sets_;               /* Parsed Forms with ModEvents, valid only while configs are processed. */
+			MapModEvents mod_event_removals_;               /* All valid Forms removed by ModEvents. */
+			MapModEventsSets mod_event_removal_sets_;       /* Parsed Forms removed by ModEvents, valid only while configs are processed. */
+			SymbolMap<int> filters_;                        /* All valid Filters with their result, 1 if met, -1 if not. */
+			FormListsData form_lists_;                      /* All valid Forms for FormLists. */
+			FormListsSets form_list_sets_;                  /* Parsed Forms for FormLists, valid only while configs are processed. */
+			FormListsData form_list_removals_;              /* All valid Forms removed from FormLists. */
+			FormListsSets form_list_removal_sets_;          /* Parsed Forms removed from FormLists, valid only while configs are processed. */
+			FormIdPairs plants_;                            /* All valid Forms with seeds and plants. */
+			Forms boy_toys_;                                /* All valid Forms with boy's toys. */
+			Forms girl_toys_;                               /* All valid Forms with girl's toys. */
+			Forms hair_colors_;                             /* All valid Forms with hair colors. */
+			FormIdPairs atronach_forge_;                    /* All valid Forms with recipes and results for Atronach Forge. */
+			FormIdPairs atronach_sigil_forge_;              /* All valid Forms with recipes and results for Atronach Forge with Sigil. */
+			FormIdPairs dragon_spider_crafting_;            /* All valid Forms with recipes and results for Dragonborn Spider Crafting. */
+			SymbolMap<KeywordsPairVec> collections_data_;   /* All valid data for Collections. */
+			MapKeywords keywords_cache_;                    /* All valid keywords. */
+			std::string filter_name_;                       /* Scratch for names of Filters, which are not case-sensitive. */
+			InsertionLog inserted_;                         /* Forms inserted during initialization. */
+			InsertionLog saved_;                            /* Forms inserted in the current game, read from the cosave and added by Mod Events. */
+			TransactionLog transactions_;                   /* Forms inserted by every application of Mod Events in the current game. */
+			std::chrono::microseconds reload_time_{};       /* Time spent on restoring Forms after new game or load. */
+			std::shared_future<void> found_;                /* Processing of configs on the background thread, shared by every thread that waits for it. */
+			std::atomic<bool> applied_ = false;             /* True, if Forms from configs were added. Changed only on the main thread. */
+			StringSet event_names_;                         /* Names of Mod Events in configs, written once before they are published. */
+			std::promise<void> events_read_;                /* Fulfilled once, when names of Mod Events are known. */
+			std::shared_future<void> events_known_ = events_read_.get_future().share(); /* Waited for by event sinks before names of Mod Events are used. */
+			std::atomic<bool> distributing_ = false;        /* True, if configs are being read, so event sinks wait for names of Mod Events. */
+			std::atomic<bool> events_published_ = false;    /* True, if names of Mod Events were published. */
+
+			/* All valid Collections for FormTypes. */
+			StringMap<std::vector<SymbolId>> collections_form_types_;
 
+			/**
+			 * \brief Adds all Forms from config files once and sends the mod event that FLM has completed its work.
+			 */
+			void apply();
+			/**
+			 * \brief Publishes names of Mod Events to event sinks. Only the first call publishes them, later distributions do not change them.
+			 */
+			void publishEvents();
+			/**
+			 * \brief Drops all Forms found in configs, so nothing from partly processed configs is added.
+			 */
+			void clearFound();
 			/**
 			 * \brief Clears data related to added game forms.
 			 */
@@ -86,41 +199,18 @@ namespace flm
 			void findLists();
 
 			/**
-			 * \brief Finds all config files. Finds all configuration files. Reads data from configuration files and adds the correct entries to internal structures.
+			 * \brief Finds all config files. Reads and tokenizes each config file once, then adds the correct entries to internal structures.
 			 */
 			void findConfigs();
 			/**
-			 * \brief Perform parsing of the entry if the key is in the type.
-			 * \param key                   - Key to check.
+			 * \brief Parses the entry with the function for its type and counts it as valid or invalid.
 			 * \param entry                 - Entry to parse.
-			 * \param type                  - Entry type.
-			 * \return                      - True if the key is valid.
-			 */
-			bool addIfKeyIs(const std::string& key, const std::string& entry, EntryType::EntryType type);
-			/**
-			 * \brief Adds the correct plants to the game.
-			 */
-			void addPlants();
-			/**
-			 * \brief Adds the correct kids toys to the game.
-			 */
-			void addKidsToys();
-			/**
-			 * \brief Adds the correct hair colors to the game.
-			 */
-			void addHairColors();
-			/**
-			 * \brief Adds the correct pairs of recipes and results to the game.
-			 */
-			void addAtronachForgeRecipes();
-			/**
-			 * \brief Adds the correct pairs of recipes and results with Sigil Stone to the game.
 			 */
-			void addAtronachForgeSigilRecipes();
+			void parseEntry(const ConfigEntry& entry);
 			/**
-			 * \brief Adds the correct pairs of recipes and results for Dragonborn Spider Crafting to the game.
+			 * \brief Turns parsed Forms of FormLists and Mod Events into unique FormIDs, in order they were first seen.
 			 */
-			void addDragonbornSpiderCrafting();
+			void finalizePayloads();
 			/**
 			 * \brief Adds forms to the game.
 			 * \param header                    - Header of Forms that are added.
@@ -131,62 +221,57 @@ namespace flm
 			 */
 			void addForms(const std::string_view header, const std::string_view name, const Forms& forms, const Flt formType, InfoTPair infos);
 			/**
-			 * \brief Adds pair of forms to the game.
+			 * \brief Adds pair of forms to the game. Both FormLists are indexed, so a duplicate is found with two hash lookups, and both are appended in one batch.
+			 * Alignment of both FormLists is checked before and after adding.
 			 * \param header                    - Header of Forms that are added.
 			 * \param names                     - Name of Forms that are added.
-			 * \param forms                     - A vector of form pairs to add.
+			 * \param forms                     - Form pairs to add.
 			 * \param formTypes                 - Forms pair types that are added.
 			 * \param infos                     - The type of information referring to the type of added and duplicated forms, is used to count correctly added/duplicated forms.
 			 */
-			void addFormPair(const std::string_view header, const StringViewPair& names, FormsPairs& forms, FltPair formTypes, InfoTPair infos);
+			void addFormPair(const std::string_view header, const StringViewPair& names, const FormIdPairs& forms, FltPair formTypes, InfoTPair infos);
 			/**
 			 * \brief Adds Form and FromList to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format FList|Form, Form, #Group, etc.
+			 * \param sections                  - Sections of the entry in the format FList|Form, Form, #Group, etc.
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parseFormList(const std::string& entry);
+			bool parseFormList(const Sections& sections);
 			/**
-			 * \brief Adds Seed end Plant to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format Seed|Plant
+			 * \brief Adds Forms removed from FromList to internal structure based on string entry. String is validated.
+			 * \param sections                  - Sections of the entry in the format FList|Form, Form, #Group, etc.
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parsePlant(const std::string& entry);
+			bool parseFormListRemove(const Sections& sections);
 			/**
-			 * \brief Adds Boy's Toys to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format Form, Form, #Group, etc.
+			 * \brief Adds Form and FromList to the structure based on string entry. String is validated.
+			 * \param sections                  - Sections of the entry in the format FList|Form, Form, #Group, etc.
+			 * \param target                    - Parsed Forms for FormLists, where the Forms will be added.
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parseBToys(const std::string& entry);
-
-			/**
-			 * \brief Adds Girl's Toys to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format Form, Form, #Group, etc.
-			 * \return                          - True, if everything went fine.
-			 */
-			bool parseGToys(const std::string& entry);
+			bool parseFormListEntry(const Sections& sections, FormListsSets& target);
 			/**
 			 * \brief Adds Alias to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format NameForAlias|FList, FList, etc.
+			 * \param sections                  - Sections of the entry in the format NameForAlias|FList, FList, etc.
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parseAlias(const std::string& entry);
+			bool parseAlias(const Sections& sections);
 			/**
 			 * \brief Adds Group to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format NameForGroup|From, From, etc.
+			 * \param sections                  - Sections of the entry in the format NameForGroup|From, From, etc.
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parseGroup(const std::string& entry);
+			bool parseGroup(const Sections& sections);
 			/**
 			 * \brief Adds Collection to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format Collection = NameForCollection|FormType|Keyword/s[|Filter]
+			 * \param sections                  - Sections of the entry in the format Collection = NameForCollection|FormType|Keyword/s[|Filter]
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parseCollection(const std::string& entry);
+			bool parseCollection(const Sections& sections);
 			/**
-			 * \brief Adds Forms to collections of specific type (Armor, Weapon, etc) based on tags.
+			 * \brief Adds Forms to collections of specific type (Armor, Weapon, etc) based on tags. Only Collections declared with the type are matched.
 			 * \tparam T                        - Class of collection type (RE::TESObjectARMO, RE::TESObjectWEAP, etc).
 			 * \param formType                  - Collection type (Armor, Weapon, etc).
-			 * \return 
+			 * \return                          - True, if the data handler is available.
 			 */
 			template<class T>
 			bool addParsedCollection(std::string_view formType);
@@ -197,79 +282,108 @@ namespace flm
 			bool addAllParsedCollections();
 			/**
 			 * \brief Adds Filter to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format NameFilter|+/-Plugin, +/-Plugin, etc.
+			 * \param sections                  - Sections of the entry in the format NameFilter|+/-Plugin, +/-Plugin, etc.
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parseFilter(const std::string& entry);
+			bool parseFilter(const Sections& sections);
 			/**
 			 * \brief Adds ModEvent to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format FList|Form, Form, #Group, etc.
+			 * \param sections                  - Sections of the entry in the format FList|Form, Form, #Group, etc.
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parseModEvent(const std::string& entry);
+			bool parseModEvent(const Sections& sections);
 			/**
-			 * \brief Adds Hair Colors to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format Form, Form, #Group, etc.
+			 * \brief Adds ModEvent that removes Forms to internal structure based on string entry. String is validated.
+			 * \param sections                  - Sections of the entry in the format EventName|FList|Form, Form, #Group, etc.
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parseHairColors(const std::string& entry);
+			bool parseModEventRemove(const Sections& sections);
 			/**
-			 * \brief Adds recipe and result to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format Recipe|Result.
+			 * \brief Adds ModEvent to the structure based on string entry. String is validated.
+			 * \param sections                  - Sections of the entry in the format EventName|FList|Form, Form, #Group, etc.
+			 * \param target                    - Parsed Forms for Mod Events, where the Forms will be added.
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parseAtronachForge(const std::string& entry);
+			bool parseModEventEntry(const Sections& sections, MapModEventsSets& target);
 			/**
 			 * \brief Adds recipe and result to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format Recipe|Result.
-			 * \return                          - True, if everything went fine.
-			 */
-			bool parseAtronachForgeSigil(const std::string& entry);
-			/**
-			 * \brief Adds recipe and result to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format Recipe|Result.
-			 * \return                          - True, if everything went fine.
-			 */
-			bool parseDragonbornSpiderCrafting(const std::string& entry);
-			/**
-			 * \brief Adds recipe and result to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format Form, Form, #Group, etc.
+			 * \param sections                  - Sections of the entry in the format Form, Form, #Group, etc.
 			 * \param entryName                 - Name of the entry.
 			 * \param list                      - The list to which the correct Forms will be added.
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parseList(const std::string entry, std::string_view entryName, Forms& list);
+			bool parseList(const Sections& sections, std::string_view entryName, Forms& list);
 			/**
 			 * \brief Adds recipe and result to internal structure based on string entry. String is validated.
-			 * \param entry                     - String in the format Recipe|Result.
+			 * \param sections                  - Sections of the entry in the format Recipe|Result.
 			 * \param names                     - Names of: the entry, first pair element, second pair element.
 			 * \param list                      - The list to which the correct pair will be added.
 			 * \param plantTypesWarn            - If True, checks pair form types for seed and plant.
 			 * \return                          - True, if everything went fine.
 			 */
-			bool parsePair(const std::string& entry, const PairEntryNames& names, FormsPairs& list, bool plantTypesWarn = false);
+			bool parsePair(const Sections& sections, const PairEntryNames& names, FormIdPairs& list, bool plantTypesWarn = false);
+			/**
+			 * \brief Adds Forms or pairs of the simplified entry to internal structure based on string entry. String is validated.
+			 * \param entry                     - Simplified entry of the type.
+			 * \param sections                  - Sections of the entry in the format Form, Form, #Group, etc. or Recipe|Result.
+			 * \return                          - True, if everything went fine.
+			 */
+			bool parseSimplified(const SimplifiedEntry& entry, const Sections& sections);
 			/**
 			 * \brief Parse form entry.
 			 * \param entry                 - Entry to parse.
 			 * \param forms                 - Forms vector, where the found forms will be added.
+			 * \param sets                  - If set, Groups and Collections are shared instead of copied into forms. Forms found so far are moved to a new set first.
 			 * \return                      - 0 if the entry is valid, -1 if the form is missing, -2 if the group is missing.
 			 */
-			int parseFormEntry(std::string& entry, Forms& forms);
+			int parseFormEntry(std::string_view entry, Forms& forms, FormSets* sets = nullptr);
 			/**
-			 * \brief Adds From to FormList. Duplicates are omitted.
-			 * \param list                      - FromList where Form will be added.
-			 * \param form                      - Form to add.
-			 * \return                          - True, if everything went fine.
+			 * \brief Resolves the Alias on first use. Every Alias is resolved exactly once and counted then as a valid or invalid entry.
+			 * \param id                    - ID of the Alias name.
+			 * \return                      - FormLists of the Alias, nullptr if the Alias is unknown or empty.
 			 */
-			bool addFormToFormList(RE::BGSListForm*& list, RE::TESForm* form) const;
+			const FormsLists* resolveAlias(SymbolId id);
+			/**
+			 * \brief Resolves the Group on first use, with Groups and Collections it uses. Every Group is resolved exactly once and counted then as a valid or invalid entry.
+			 * \param id                    - ID of the Group name.
+			 * \return                      - Forms of the Group, nullptr if the Group is unknown, empty or uses itself.
+			 */
+			SharedForms resolveGroup(SymbolId id);
+			/**
+			 * \brief Counts Forms in all sets.
+			 * \param sets                  - Sets of Forms.
+			 * \return                      - Amount of Forms.
+			 */
+			static int countForms(const FormSets& sets);
 			/**
 			 * \brief Evaluate Filter.
 			 * \param filter                    - Filter to evaluate in format: #FilterName or +/-ESP[&+-ESP], +/-ESP[&+-ESP], itd.
 			 * \return                          - 1, if Filter meet criteria, 0 if invalid, -1 if did not meet criteria.
 			 */
-			inline int evaluateFilter(const std::string& filter);
+			inline int evaluateFilter(const Section& filter);
 	};
 
+	inline const std::array<Manipulator::ParseEntry, Manipulator::simplified_first> Manipulator::parsers_{
+		&Manipulator::parseAlias,          /* Aliases for FormLists. */
+		&Manipulator::parseGroup,          /* Groups for Forms. */
+		&Manipulator::parseCollection,     /* Collections for Forms with specific keyword. */
+		&Manipulator::parseFilter,         /* Filters for Entries. */
+		&Manipulator::parseModEvent,       /* Mod events. */
+		&Manipulator::parseFormList,       /* FromList. */
+		&Manipulator::parseFormListRemove, /* Forms removed from FromList. */
+		&Manipulator::parseModEventRemove, /* Mod events that remove Forms. */
+	};
+
+	inline const std::array<Manipulator::SimplifiedEntry, EntryType::ALL - Manipulator::simplified_first> Manipulator::simplified_entries_{ {
+		{ "PLANTS"sv, { "Plant"sv, "Seed"sv, "Plant"sv }, { FormListType::SEED, FormListType::PLANT }, { ift::PLANTS_ADD, ift::PLANTS_DUP }, nullptr, &Manipulator::plants_, true },
+		{ "BOY'S TOYS"sv, { "Boy's Toys"sv, "Boy's Toy"sv, {} }, { FormListType::BTOYS, FormListType::ALL }, { ift::B_TOYS, ift::B_TOYS_DUP }, &Manipulator::boy_toys_ },
+		{ "GIRL'S TOYS"sv, { "Girl's Toys"sv, "Girls's Toy"sv, {} }, { FormListType::GTOYS, FormListType::ALL }, { ift::G_TOYS, ift::G_TOYS_DUP }, &Manipulator::girl_toys_ },
+		{ "HAIR COLORS"sv, { "Hair Colors"sv, "Hair Color"sv, {} }, { FormListType::HAIRC, FormListType::ALL }, { ift::HAIRC, ift::HAIRC_DUP }, &Manipulator::hair_colors_ },
+		{ "ATRONACH FORGE"sv, { "Atronach Forge"sv, "Recipe"sv, "Result"sv }, { FormListType::AFREC, FormListType::AFRES }, { ift::AFORG_ADD, ift::AFORG_DUP }, nullptr, &Manipulator::atronach_forge_ },
+		{ "ATRONACH FORGE WITH SIGIL STONE"sv, { "Atronach Forge with Sigil Stone"sv, "Recipe"sv, "Result"sv }, { FormListType::ASFRC, FormListType::ASFRS }, { ift::ASFRG_ADD, ift::ASFRG_DUP }, nullptr, &Manipulator::atronach_sigil_forge_ },
+		{ "DRAGONBORN SPIDER CRAFTING"sv, { "Dragonborn Spider Crafting"sv, "Recipe"sv, "Result"sv }, { FormListType::DSREC, FormListType::DSRES }, { ift::DSREC_ADD, ift::DSREC_DUP }, nullptr, &Manipulator::dragon_spider_crafting_ },
+	} };
+
 	inline Manipulator::Manipulator()
 	{
 		infos_.fill(0);
@@ -279,27 +393,228 @@ namespace flm
 	{
 		findLists();
 		findConfigs();
+		resolver_.Clear();
 	}
 
 	inline void Manipulator::AddAll()
 	{
 		clearDataInfo();
-		addPlants();
-		addKidsToys();
-		addHairColors();
-		addAtronachForgeRecipes();
-		addAtronachForgeSigilRecipes();
-		auto [added, duplicates] = AddGeneric(form_lists_);
+
+		// After the initialization, only Forms inserted by FLM are checked. Everything else on the FormLists does not change with a save.
+		if(log::operating_mode != OperatingMode::INITIALIZE)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			// The cosave already holds Forms inserted at the initialization, so the union of both logs is checked once.
+			infos_[ift::RELOAD_CHK] = InsertionLog::Merge({ &inserted_, &saved_ }).Restore(infos_);
+			std::tie(infos_[ift::FORMS_REM], infos_[ift::FORMS_REM_MIS]) = RemoveGeneric(form_list_removals_, { &inserted_, &saved_ });
+			reload_time_ = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			summary();
+			return;
+		}
+
+		inserted_.Clear();
+		for(const auto& entry : simplified_entries_)
+		{
+			if(entry.pairs)
+				addFormPair(entry.header, { std::get<1>(entry.names), std::get<2>(entry.names) }, this->*entry.pairs, entry.lists, entry.infos);
+			else
+				addForms(entry.header, std::get<1>(entry.names), this->*entry.forms, entry.lists.first, entry.infos);
+		}
+		auto [added, duplicates] = AddGeneric(form_lists_, &inserted_);
 		infos_[ift::FORMS_ADD] += added;
 		infos_[ift::FORMS_DUP] += duplicates;
+		std::tie(infos_[ift::FORMS_REM], infos_[ift::FORMS_REM_MIS]) = RemoveGeneric(form_list_removals_, { &inserted_, &saved_ });
 		summary();
 	}
 
+	inline void Manipulator::Distribute()
+	{
+		distributing_ = true;
+
+		if(!DiscoverConfigs().async_mode)
+		{
+			FindAll();
+			publishEvents();
+			apply();
+			return;
+		}
+
+		log::Info("Asynchronous mode enabled, processing configs in the background...");
+		found_ = std::async(std::launch::async, [this]
+							{
+								const auto start = std::chrono::steady_clock::now();
+								try
+								{
+									FindAll();
+								}
+								catch(...)
+								{
+									// Event sinks must not wait forever for names of Mod Events, the error is reported by WaitReady on the main thread.
+									publishEvents();
+									SKSE::GetTaskInterface()->AddTask([this]
+																	  { WaitReady(); });
+									throw;
+								}
+								publishEvents();
+								log::Info("Configs processed in the background in {:.3f} ms.",
+										  static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()) / 1000.0);
+								SKSE::GetTaskInterface()->AddTask([this]
+																  { WaitReady(); });
+							})
+					 .share();
+	}
+
+	inline void Manipulator::WaitReady()
+	{
+		if(!found_.valid())
+			return;
+
+		if(found_.wait_for(std::chrono::seconds::zero()) != std::future_status::ready)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			found_.wait();
+			log::Info("Waited {:.3f} ms for configs processed in the background.",
+					  static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()) / 1000.0);
+		}
+
+		try
+		{
+			found_.get();
+		}
+		catch(const std::exception& e)
+		{
+			log::Error("Processing of configs in the background failed: {}. No Forms from configs will be added.", e.what());
+			clearFound();
+		}
+		catch(...)
+		{
+			log::Error("Processing of configs in the background failed. No Forms from configs will be added.");
+			clearFound();
+		}
+		apply();
+	}
+
+	inline void Manipulator::WaitFound() const
+	{
+		if(const auto found = found_; found.valid())
+			found.wait();
+	}
+
+	inline bool Manipulator::Ready() const
+	{
+		return applied_;
+	}
+
+	inline bool Manipulator::HandlesEvent(const std::string_view name) const
+	{
+		// Before the distribution starts, no Mod Events are known.
+		if(!distributing_)
+			return false;
+
+		events_known_.wait();
+
+		if(event_names_.contains(name))
+			return true;
+		return name.ends_with(undo_suffix) && event_names_.contains(name.substr(0, name.size() - undo_suffix.size()));
+	}
+
+	inline void Manipulator::publishEvents()
+	{
+		if(events_published_.exchange(true))
+			return;
+
+		events_read_.set_value();
+	}
+
+	inline void Manipulator::clearFound()
+	{
+		mod_events_ = {};
+		mod_event_removals_ = {};
+		form_lists_ = {};
+		form_list_removals_ = {};
+		plants_ = {};
+		boy_toys_ = {};
+		girl_toys_ = {};
+		hair_colors_ = {};
+		atronach_forge_ = {};
+		atronach_sigil_forge_ = {};
+		dragon_spider_crafting_ = {};
+	}
+
+	inline void Manipulator::apply()
+	{
+		if(applied_)
+			return;
+
+		applied_ = true;
+		AddAll();
+		SendEventDone();
+	}
+
 	inline MapModEvents& Manipulator::GetModEvents()
 	{
 		return mod_events_;
 	}
 
+	inline MapModEvents& Manipulator::GetModEventRemovals()
+	{
+		return mod_event_removals_;
+	}
+
+	inline bool Manipulator::HasModEvent(const std::string_view name) const
+	{
+		return mod_events_.contains(name) || mod_event_removals_.contains(name);
+	}
+
+	inline TransactionLog& Manipulator::GetTransactions()
+	{
+		return transactions_;
+	}
+
+	inline InsertionLog& Manipulator::GetSavedInsertions()
+	{
+		return saved_;
+	}
+
+	inline void Manipulator::Save(const SKSE::SerializationInterface* serialization) const
+	{
+		InsertionLog::Save(serialization, { &inserted_, &saved_ });
+		transactions_.Save(serialization);
+	}
+
+	inline void Manipulator::Load(const SKSE::SerializationInterface* serialization)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		std::uint32_t type = 0;
+		std::uint32_t version = 0;
+		std::uint32_t length = 0;
+		while(serialization->GetNextRecordInfo(type, version, length))
+		{
+			if(type == InsertionLog::record)
+			{
+				if(!saved_.Load(serialization, version, length))
+					log::Error("Unable to read FormLists from the cosave.");
+			}
+			else if(type == TransactionLog::record)
+			{
+				if(!transactions_.Load(serialization, version, length))
+					log::Error("Unable to read Mod Event transactions from the cosave.");
+			}
+			else
+				log::Warn("Unknown record {:X} in the cosave, skipping.", type);
+		}
+
+		log::Info("{} Forms inserted by FLM read from the cosave in {:.3f} ms.",
+				  saved_.Size(),
+				  static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()) / 1000.0);
+	}
+
+	inline void Manipulator::Revert()
+	{
+		saved_.Clear();
+		transactions_.Clear();
+	}
+
 	inline void Manipulator::SendEventDone()
 	{
 		const SKSE::ModCallbackEvent mod_event{ "FLM_SetupDone", {}, 0.0f, nullptr };
@@ -331,6 +646,13 @@ namespace flm
 
 		infos_[ift::DSREC_ADD] = 0;
 		infos_[ift::DSREC_DUP] = 0;
+
+		infos_[ift::FORMS_REM] = 0;
+		infos_[ift::FORMS_REM_MIS] = 0;
+
+		infos_[ift::PAIRS_MISAL] = 0;
+
+		infos_[ift::RELOAD_CHK] = 0;
 	}
 
 	inline void Manipulator::findLists()
@@ -345,34 +667,25 @@ namespace flm
 
 	inline void Manipulator::findConfigs()
 	{
-		const std::filesystem::directory_entry debug_mode_toggle(R"(Data\FormListManipulator_DEBUG.ini)");
-		const std::filesystem::directory_entry debug_mode_toggle1(R"(Data\FLM\FormListManipulator_DEBUG.ini)");
-		const std::filesystem::directory_entry debug_mode_toggle2(R"(Data\SKSE\Plugins\FormListManipulator_DEBUG.ini)");
-		if(debug_mode_toggle.exists() || debug_mode_toggle1.exists() || debug_mode_toggle2.exists())
+		const auto& discovery = DiscoverConfigs();
+		if(discovery.debug_mode)
 		{
 			log::Header("DEBUG MODE ENABLED"sv);
 			log::debug_mode = true;
 		}
 
 		log::Header("Looking for configs"sv);
-		Strings configs = clib_util::distribution::get_configs(R"(Data\)", "_FLM"sv);
-
-		if(auto constexpr folder_flm = R"(Data\FLM)"; std::filesystem::directory_entry(folder_flm).exists())
-			for(const auto iterator = std::filesystem::directory_iterator(folder_flm); const auto& entry : iterator)
-				if(entry.exists() && !entry.path().empty() && entry.path().extension() == ".ini"sv)
-				{
-					if(entry.path().string() == "FormListManipulator_DEBUG.ini"sv)
-						continue;
-					configs.push_back(entry.path().string());
-				}
+		if(discovery.manifest)
+			log::Info("Using configs listed in {}.", config_manifest);
 
+		const Strings& configs = discovery.configs;
 		if(configs.empty())
 		{
 			log::Warn("Configs not found!");
 			return;
 		}
 		else
-			log::Info("Found {} configs.", configs.size());
+			log::Info("Found {} configs in {:.3f} ms.", configs.size(), static_cast<double>(discovery.time.count()) / 1000.0);
 
 		if(log::debug_mode)
 			log::Header("Looking for keywords"sv);
@@ -385,52 +698,73 @@ namespace flm
             log::Header();
 		}
 
-		log::Header("Processing configs for filters & collections"sv);
-		log::indent_level++;
+		// Reading and tokenizing does not depend on other configs, so it runs concurrently. The results keep the order of the configs,
+		// so the passes below process entries exactly in the same order as they would be read one by one.
+		ConfigCache cache;
+		cache.Load(ConfigCache::HashPlugins());
+
+		ConfigFiles configs_data(configs.size());
+		std::transform(std::execution::par, configs.begin(), configs.end(), configs_data.begin(), [&cache](const std::string& path)
+					   { return LoadConfig(path, cache); });
+
+		// Names of Mod Events are known right after reading, so event sinks do not wait for processing of configs to find out if an event is handled by FLM.
+		// They are written only before the first publication, event sinks read them without a lock.
+		if(!events_published_)
+		{
+			for(const auto& config : configs_data)
+				for(const auto& entry : config.entries)
+					if((entry.type == EntryType::MODEV || entry.type == EntryType::MEREM) && !entry.sections.empty())
+						event_names_.emplace(entry.sections[0].text);
+			publishEvents();
+		}
 
-		for(auto& path : configs)
+		// Configs that failed to load are not cached, so only loaded configs decide if the cache is outdated.
+		const auto loaded = std::ranges::count_if(configs_data, [](const ConfigFile& config)
+												  { return config.loaded; });
+		if(const auto cached = std::ranges::count_if(configs_data, [](const ConfigFile& config)
+													 { return config.cached; });
+		   cached != loaded)
 		{
-			CSimpleIniA ini;
-			ini.SetUnicode();
-			ini.SetMultiKey();
+			log::Info("Restored {} of {} configs from the cache.", cached, loaded);
+			cache.Store(configs_data);
+		}
+		else
+			log::Info("Restored all configs from the cache.");
+
+		log::Header("Processing configs for filters, collections, aliases & groups"sv);
+		log::indent_level++;
 
-			if(const auto rc = ini.LoadFile(path.c_str()); rc < 0)
+		for(const auto& config : configs_data)
+		{
+			if(!config.loaded)
 			{
-				log::Error("Can't read ini {}.", path);
+				log::Error("Can't read ini {}.", config.path);
 				continue;
 			}
 
-
-			log::Info("Processing {}...", path);
+			log::Info("Processing {}...", config.path);
 			log::indent_level++;
 
-			if(auto values = ini.GetSection(""); values)
+			if(!config.entries.empty())
 			{
 				int valid_entries = infos_[ift::ENTRIES_V];    /* How many valid entries is. */
 				int invalid_entries = infos_[ift::ENTRIES_IN]; /* How many invalid entries is. */
 				int filtered_out = infos_[ift::ENTRIES_FO];    /* How many entries did not meet criteria. */
 
 				// Parse Filters first.
-				for(auto& [key, entry] : *values)
-				{
-					std::string sanitized_entry = Sanitize(entry);
-					std::string lowercase_key = key.pItem;
-					ToLower(lowercase_key);
-
-					if(addIfKeyIs(lowercase_key, sanitized_entry, EntryType::FILTR))
-						continue;
-				}
+				for(const auto& entry : config.entries)
+					if(entry.type == EntryType::FILTR)
+						parseEntry(entry);
 
 				// Parse Collections next.
-				for(auto& [key, entry] : *values)
-				{
-					std::string sanitized_entry = Sanitize(entry);
-					std::string lowercase_key = key.pItem;
-					ToLower(lowercase_key);
+				for(const auto& entry : config.entries)
+					if(entry.type == EntryType::COLLE)
+						parseEntry(entry);
 
-					if(addIfKeyIs(lowercase_key, sanitized_entry, EntryType::COLLE))
-						continue;
-				}
+				// Define Aliases and Groups, they are resolved after all configs are read, so they can be used before their definition.
+				for(const auto& entry : config.entries)
+					if(entry.type == EntryType::ALIAS || entry.type == EntryType::GROUP)
+						parseEntry(entry);
 
 				valid_entries = infos_[ift::ENTRIES_V] - valid_entries;
 				invalid_entries = infos_[ift::ENTRIES_IN] - invalid_entries;
@@ -452,9 +786,9 @@ namespace flm
 			{
                 log::Header("Adding forms to collections");
 				log::indent_level++;
-				log::Info("Added {} Collections.", collections_.size());
-				for(const auto& c : collections_)
-					log::Info("Collection {} ==> forms: {}.", c.first, c.second.size());
+				log::Info("Added {} Collections.", collections_.Size());
+				for(const auto id : collections_.Ids())
+					log::Info("Collection {} ==> forms: {}.", symbols_.Name(id), (*collections_.Find(id))->size());
 				log::indent_level--;
                 log::Header();
 			}
@@ -463,63 +797,51 @@ namespace flm
 		else
 			log::Error("Error during Collections adding.");
 
+		// All definitions and Collections are known now, so definitions are resolved before entries use them and counted as valid or invalid.
+		{
+			const int valid_definitions = infos_[ift::ENTRIES_V];
+			const int invalid_definitions = infos_[ift::ENTRIES_IN];
+			for(const auto id : group_definitions_.Ids())
+				resolveGroup(id);
+			for(const auto id : alias_definitions_.Ids())
+				resolveAlias(id);
+			log::Info("Resolved Aliases and Groups, {} valid, {} invalid.", infos_[ift::ENTRIES_V] - valid_definitions, infos_[ift::ENTRIES_IN] - invalid_definitions);
+		}
+
 		log::Header("Processing configs"sv);
 		log::indent_level++;
 
-		for(auto& path : configs)
+		for(const auto& config : configs_data)
 		{
-			CSimpleIniA ini;
-			ini.SetUnicode();
-			ini.SetMultiKey();
-
-			if(const auto rc = ini.LoadFile(path.c_str()); rc < 0)
+			if(!config.loaded)
 			{
-				log::Error("Can't read ini {}.", path);
+				log::Error("Can't read ini {}.", config.path);
 				infos_[ift::CONFIGS_IN]++;
 				continue;
 			}
 
 			infos_[ift::CONFIGS_V]++;
 
-			log::Info("Processing {}...", path);
+			log::Info("Processing {}...", config.path);
 			log::indent_level++;
 
-			if(auto values = ini.GetSection(""); values)
+			if(!config.entries.empty())
 			{
 				int valid_entries = infos_[ift::ENTRIES_V];    /* How many valid entries is. */
 				int invalid_entries = infos_[ift::ENTRIES_IN]; /* How many invalid entries is. */
 				int filtered_out = infos_[ift::ENTRIES_FO];    /* How many entries did not meet criteria. */
 
-				// Parse Aliases and Groups next.
-				for(auto& [key, entry] : *values)
-				{
-					std::string sanitized_entry = Sanitize(entry);
-					std::string lowercase_key = key.pItem;
-					ToLower(lowercase_key);
-
-					if(addIfKeyIs(lowercase_key, sanitized_entry, EntryType::ALIAS))
-						continue;
-
-					if(addIfKeyIs(lowercase_key, sanitized_entry, EntryType::GROUP))
-						continue;
-				}
-
-				for(auto& [key, entry] : *values)
+				for(const auto& entry : config.entries)
 				{
-					std::string sanitized_entry = Sanitize(entry);
-					std::string lowercase_key = key.pItem;
-					ToLower(lowercase_key);
-
-					if(std::ranges::find(keywords, lowercase_key) == keywords.end())
+					if(entry.type == EntryType::ALL)
 					{
-						log::Error("Unknown key {}!", key.pItem);
+						log::Error("Unknown key {} in entry {}!", entry.key, entry.line);
 						invalid_entries++;
 						continue;
 					}
 
-					for(int type = EntryType::MODEV; type != EntryType::ALL; type++)
-						if(addIfKeyIs(lowercase_key, sanitized_entry, static_cast<EntryType::EntryType>(type)))
-							break;
+					if(entry.type >= EntryType::MODEV)
+						parseEntry(entry);
 				}
 				valid_entries = infos_[ift::ENTRIES_V] - valid_entries;
 				invalid_entries = infos_[ift::ENTRIES_IN] - invalid_entries;
@@ -531,6 +853,13 @@ namespace flm
 
 			log::indent_level--;
 		}
+
+		// Definitions point to the configs, so they are dropped.
+		group_definitions_ = {};
+		alias_definitions_ = {};
+
+		finalizePayloads();
+
 		log::indent_level--;
 		log::Info("Reading configs complete, {} valid configs found, {} invalid. {} valid entries found, {} invalid, {} filtered out.",
 				  infos_[ift::CONFIGS_V],
@@ -541,62 +870,24 @@ namespace flm
 		log::Header();
 	}
 
-	inline bool Manipulator::addIfKeyIs(const std::string& key, const std::string& entry, const EntryType::EntryType type)
+	inline void Manipulator::parseEntry(const ConfigEntry& entry)
 	{
-		if(key == keywords[type])
+		if(log::debug_mode)
 		{
-			if(log::debug_mode)
-			{
-				log::Info("Processing entry: {}.", entry);
-				log::indent_level++;
-			}
-			if((add_callbacks_[type])(entry))
-			{
-				infos_[ift::ENTRIES_V]++;
-				if(log::debug_mode)
-					log::indent_level--;
-				return true;
-			}
-			else
-			{
-				infos_[ift::ENTRIES_IN]++;
-				if(log::debug_mode)
-					log::indent_level--;
-				return true;
-			}
+			log::Info("Processing entry: {}.", entry.value);
+			log::indent_level++;
 		}
-		return false;
-	}
-
-	inline void Manipulator::addPlants()
-	{
-		addFormPair("PLANTS"sv, std::make_pair("Seed"sv, "Plant"sv), plants_, std::make_pair(FormListType::SEED, FormListType::PLANT), std::make_pair(ift::PLANTS_ADD, ift::PLANTS_DUP));
-	}
-
-	inline void Manipulator::addKidsToys()
-	{
-		addForms("BOY'S TOYS"sv, "Boy's Toy"sv, boy_toys_, FormListType::BTOYS, std::make_pair(ift::B_TOYS, ift::B_TOYS_DUP));
-		addForms("GIRL'S TOYS"sv, "Girls's Toy"sv, girl_toys_, FormListType::GTOYS, std::make_pair(ift::G_TOYS, ift::G_TOYS_DUP));
-	}
-
-	inline void Manipulator::addHairColors()
-	{
-		addForms("HAIR COLORS"sv, "Hair Color"sv, hair_colors_, FormListType::HAIRC, std::make_pair(ift::HAIRC, ift::HAIRC_DUP));
-	}
-
-	inline void Manipulator::addAtronachForgeRecipes()
-	{
-		addFormPair("ATRONACH FORGE"sv, std::make_pair("Recipe"sv, "Result"sv), atronach_forge_, std::make_pair(FormListType::AFREC, FormListType::AFRES), std::make_pair(ift::AFORG_ADD, ift::AFORG_DUP));
-	}
 
-	inline void Manipulator::addAtronachForgeSigilRecipes()
-	{
-		addFormPair("ATRONACH FORGE WITH SIGIL STONE"sv, std::make_pair("Recipe"sv, "Result"sv), atronach_sigil_forge_, std::make_pair(FormListType::ASFRC, FormListType::ASFRS), std::make_pair(ift::ASFRG_ADD, ift::ASFRG_DUP));
-	}
+		const bool valid = entry.type < simplified_first ? (this->*parsers_[entry.type])(entry.sections) :
+																parseSimplified(simplified_entries_[entry.type - simplified_first], entry.sections);
+		// Definitions of Aliases and Groups are counted when they are resolved.
+		if(!valid)
+			infos_[ift::ENTRIES_IN]++;
+		else if(entry.type != EntryType::ALIAS && entry.type != EntryType::GROUP)
+			infos_[ift::ENTRIES_V]++;
 
-	inline void Manipulator::addDragonbornSpiderCrafting()
-	{
-		addFormPair("DRAGONBORN SPIDER CRAFTING"sv, std::make_pair("Recipe"sv, "Result"sv), dragon_spider_crafting_, std::make_pair(FormListType::DSREC, FormListType::DSRES), std::make_pair(ift::DSREC_ADD, ift::DSREC_DUP));
+		if(log::debug_mode)
+			log::indent_level--;
 	}
 
 	inline void Manipulator::addForms(const std::string_view header, const std::string_view name, const Forms& forms, const Flt formType, const InfoTPair infos)
@@ -606,9 +897,10 @@ namespace flm
 			log::Header(header);
 			log::indent_level++;
 		}
+		FormListIndex index(lists_[formType]);
 		for(const auto& form : forms)
 		{
-			if(lists_[formType]->HasForm(form))
+			if(!index.Add(form))
 			{
 				if(log::operating_mode == OperatingMode::INITIALIZE && log::debug_mode)
 					log::DuplicateWarn(name, form);
@@ -616,11 +908,12 @@ namespace flm
 				continue;
 			}
 
-			lists_[formType]->AddForm(form);
 			infos_[infos.first]++;
+			inserted_.Record(lists_[formType], form, infos.first);
 			if(log::debug_mode)
 				log::Added(name, form);
 		}
+		index.Apply();
 
 		if(log::operating_mode == OperatingMode::INITIALIZE)
 		{
@@ -630,38 +923,67 @@ namespace flm
 		}
 	}
 
-	inline void Manipulator::addFormPair(const std::string_view header, const StringViewPair& names, FormsPairs& forms, const FltPair formTypes, const InfoTPair infos)
+	inline void Manipulator::addFormPair(const std::string_view header, const StringViewPair& names, const FormIdPairs& forms, const FltPair formTypes, const InfoTPair infos)
 	{
 		if(log::operating_mode == OperatingMode::INITIALIZE)
 		{
 			log::Header(header);
 			log::indent_level++;
 		}
-		for(auto& [first_form, second_form] : forms)
+
+		const auto first_list = lists_[formTypes.first];
+		const auto second_list = lists_[formTypes.second];
+		const auto check_alignment = [&]()
+		{
+			const auto first_size = FormListSize(first_list);
+			const auto second_size = FormListSize(second_list);
+			if(first_size == second_size)
+				return true;
+
+			log::Warn("FormLists {} ({} Forms) and {} ({} Forms) are not aligned, {} and {} no longer match.", GetEditorId(first_list), first_size, GetEditorId(second_list), second_size, names.first, names.second);
+			infos_[ift::PAIRS_MISAL]++;
+			return false;
+		};
+
+		const bool aligned = check_alignment();
+		FormListIndex first_index(first_list);
+		FormListIndex second_index(second_list);
+		for(std::size_t i = 0; i < forms.first.size(); i++)
 		{
-			if(lists_[formTypes.first]->HasForm(first_form))
+			const auto first_id = forms.first[i];
+			const auto second_id = forms.second[i];
+			if(first_index.Contains(first_id) || second_index.Contains(second_id))
 			{
 				if(log::operating_mode == OperatingMode::INITIALIZE && log::debug_mode)
-					log::DuplicateWarn(names.first, first_form);
+				{
+					const bool first_duplicate = first_index.Contains(first_id);
+					if(const auto form = RE::TESForm::LookupByID(first_duplicate ? first_id : second_id))
+						log::DuplicateWarn(first_duplicate ? names.first : names.second, form);
+				}
 				infos_[infos.second]++;
 				continue;
 			}
 
-			if(lists_[formTypes.second]->HasForm(second_form))
-			{
-				if(log::operating_mode == OperatingMode::INITIALIZE && log::debug_mode)
-					log::DuplicateWarn(names.second, second_form);
-				infos_[infos.second]++;
+			const auto first_form = RE::TESForm::LookupByID(first_id);
+			const auto second_form = RE::TESForm::LookupByID(second_id);
+			if(!first_form || !second_form)
 				continue;
-			}
 
-			lists_[formTypes.first]->AddForm(first_form);
-			lists_[formTypes.second]->AddForm(second_form);
+			first_index.Add(first_form);
+			second_index.Add(second_form);
 			infos_[infos.first]++;
+			inserted_.RecordPair({ first_list, second_list }, { first_form, second_form }, infos.first);
 
 			if(log::operating_mode == OperatingMode::INITIALIZE && log::debug_mode)
 				log::AddedPair(names.first, first_form, names.second, second_form);
 		}
+		first_index.Apply();
+		second_index.Apply();
+
+		// Both FormLists grow by the same amount, so only a misalignment caused by adding is reported again.
+		if(aligned)
+			check_alignment();
+
 		if(log::operating_mode == OperatingMode::INITIALIZE)
 		{
 			log::indent_level--;
@@ -706,11 +1028,12 @@ namespace flm
 					  infos_[ift::FORMS] - total_dup_forms,
 					  infos_[ift::FORMS_MISS],
 					  total_dup_forms);
-			log::Info("{} Filters added, {} duplicates, {} not existing/invalid.", filters_.size(), infos_[ift::FILTERS_DUP], infos_[ift::FILTERS_NE]);
-			log::Info("{} Forms Collections added, {} duplicates, {} not existing/invalid.", collections_.size(), infos_[ift::COLLE_DUP], infos_[ift::COLLE_NE]);
-			log::Info("{} FromLists Aliases added, {} duplicates, {} not existing.", aliases_.size(), infos_[ift::ALIASES_DUP], infos_[ift::ALIASES_NE]);
-			log::Info("{} Forms Groups added, {} duplicates, {} not existing/invalid.", groups_.size(), infos_[ift::GROUPS_DUP], infos_[ift::GROUPS_NE]);
+			log::Info("{} Filters added, {} duplicates, {} not existing/invalid.", filters_.Size(), infos_[ift::FILTERS_DUP], infos_[ift::FILTERS_NE]);
+			log::Info("{} Forms Collections added, {} duplicates, {} not existing/invalid.", collections_.Size(), infos_[ift::COLLE_DUP], infos_[ift::COLLE_NE]);
+			log::Info("{} FromLists Aliases added, {} duplicates, {} not existing.", aliases_.Size(), infos_[ift::ALIASES_DUP], infos_[ift::ALIASES_NE]);
+			log::Info("{} Forms Groups added, {} duplicates, {} not existing/invalid.", groups_.Size(), infos_[ift::GROUPS_DUP], infos_[ift::GROUPS_NE]);
 			log::Info("{} new Mod Events added, skipped {} invalid.", infos_[ift::MODEV], infos_[ift::MODEV_INV]);
+			log::Info("{} Form references resolved, {} from cache, {} looked up.", infos_[ift::RESOLVE_HIT] + infos_[ift::RESOLVE_MISS], infos_[ift::RESOLVE_HIT], infos_[ift::RESOLVE_MISS]);
 		}
 		else if(log::operating_mode == OperatingMode::NEW_GAME)
 		{
@@ -732,17 +1055,38 @@ namespace flm
 		log::Info("{} new Atronach Forge recipes added, skipped {} duplicates.", infos_[ift::AFORG_ADD], infos_[ift::AFORG_DUP]);
 		log::Info("{} new Atronach Forge recipes with Sigil Stone added, skipped {} duplicates.", infos_[ift::ASFRG_ADD], infos_[ift::ASFRG_DUP]);
 		log::Info("{} new Dragonborn Spider Crafting recipes added, skipped {} duplicates.", infos_[ift::DSREC_ADD], infos_[ift::DSREC_DUP]);
-		log::Info("{} new Forms added to {} FormLists, skipped {} duplicates.", infos_[ift::FORMS_ADD], form_lists_.size(), infos_[ift::FORMS_DUP]);
+		if(infos_[ift::PAIRS_MISAL] != 0)
+			log::Warn("{} pairs of parallel FormLists are not aligned.", infos_[ift::PAIRS_MISAL]);
+		log::Info("{} new Forms added to {} FormLists, skipped {} duplicates already on FormLists.", infos_[ift::FORMS_ADD], form_lists_.size(), infos_[ift::FORMS_DUP]);
+		if(log::operating_mode == OperatingMode::INITIALIZE && infos_[ift::FORMS_REP] != 0)
+			log::Info("{} Forms repeated in entries were dropped before adding.", infos_[ift::FORMS_REP]);
+		if(!form_list_removals_.empty())
+			log::Info("{} Forms removed from {} FormLists, {} were not on them.", infos_[ift::FORMS_REM], form_list_removals_.size(), infos_[ift::FORMS_REM_MIS]);
 
 		if(log::operating_mode != OperatingMode::INITIALIZE)
+		{
 			log::Info("Total {} new Forms added, skipped {} duplicates.", total_added_forms, total_dup_forms);
+			log::Info("Checked {} Forms inserted by FLM, {} were missing and added again in {:.3f} ms.",
+					  infos_[ift::RELOAD_CHK],
+					  total_added_forms,
+					  static_cast<double>(reload_time_.count()) / 1000.0);
+		}
 
 		log::Header(" ^_^ "sv);
 	}
 
-	inline bool Manipulator::parseFormList(const std::string& entry)
+	inline bool Manipulator::parseFormList(const Sections& sections)
+	{
+		return parseFormListEntry(sections, form_list_sets_);
+	}
+
+	inline bool Manipulator::parseFormListRemove(const Sections& sections)
+	{
+		return parseFormListEntry(sections, form_list_removal_sets_);
+	}
+
+	inline bool Manipulator::parseFormListEntry(const Sections& sections, FormListsSets& target)
 	{
-		const Strings sections = string::split(entry, "|"sv);
 		if(sections.size() != 2 && sections.size() != 3)
 		{
 			log::Error("Wrong FormList format. Expected 2 or 3 sections, got {}.", sections.size());
@@ -755,14 +1099,14 @@ namespace flm
 			if(const auto res = evaluateFilter(sections[2]); res != 1)
 				return res == 0 ? false : true;
 
-		auto form_list_info = sections[0];
+		auto form_list_info = sections[0].text;
 		FormsLists form_lists;
 
 		if(form_list_info.starts_with("#"))
 		{
-			form_list_info.erase(0, 1);
-			if(aliases_.contains(form_list_info))
-				form_lists = aliases_[form_list_info];
+			form_list_info.remove_prefix(1);
+			if(const auto alias = resolveAlias(symbols_.Find(form_list_info)))
+				form_lists = *alias;
 			else
 			{
 				log::Error("Unknown Alias: {}.", form_list_info);
@@ -772,7 +1116,7 @@ namespace flm
 		}
 		else
 		{
-			if(const auto form_list = FindForm<RE::BGSListForm>(form_list_info); !form_list)
+			if(const auto form_list = resolver_.Resolve<RE::BGSListForm>(form_list_info); !form_list)
 			{
 				log::Error("Unable to find FormList: {}.", form_list_info);
 				infos_[ift::FLIST_MIS]++;
@@ -782,132 +1126,144 @@ namespace flm
 				form_lists.emplace_back(form_list);
 		}
 
-		const auto& forms_info = sections[1];
-		Strings forms_sections = string::split(forms_info, ",");
 		Forms forms;
+		FormSets sets;
 		int missing = 0;
-		for(auto& fs : forms_sections)
-			if(parseFormEntry(fs, forms) == -1)
+		for(const auto fs : sections[1].references)
+			if(parseFormEntry(fs, forms, &sets) == -1)
 				missing++;
+		if(!forms.empty())
+			sets.push_back(std::make_shared<const Forms>(std::move(forms)));
 
 		if(!found_destination)
 			return false;
 
-		infos_[ift::FORMS] += static_cast<int>(forms.size());
+		const int amount = countForms(sets);
+		infos_[ift::FORMS] += amount;
 		infos_[ift::FORMS_MISS] += missing;
 
 		for(auto& fl : form_lists)
 		{
 			if(log::debug_mode)
-				log::Info("Found FormList {} \"{}\" [{:X}], {} Forms, {} missing Forms.", GetEditorId(fl), fl->GetName(), fl->formID, forms.size(), missing);
-			if(form_lists_.contains(fl))
-				form_lists_[fl].insert(form_lists_[fl].end(), forms.begin(), forms.end());
-			else
-				form_lists_.emplace(std::piecewise_construct, std::forward_as_tuple(fl), std::forward_as_tuple(forms));
+				log::Info("Found FormList {} \"{}\" [{:X}], {} Forms, {} missing Forms.", GetEditorId(fl), fl->GetName(), fl->formID, amount, missing);
+			auto& list_sets = target[fl];
+			list_sets.insert(list_sets.end(), sets.begin(), sets.end());
 		}
 		return true;
 	}
 
-	inline bool Manipulator::parsePlant(const std::string& entry)
-	{
-		return parsePair(entry, std::make_tuple("Plant"sv, "Seed"sv, "Plant"sv), plants_, true);
-	}
-
-	inline bool Manipulator::parseBToys(const std::string& entry)
-	{
-		return parseList(entry, "Boy's Toys", boy_toys_);
-	}
-
-	inline bool Manipulator::parseGToys(const std::string& entry)
+	inline bool Manipulator::parseAlias(const Sections& sections)
 	{
-		return parseList(entry, "Girl's Toys", girl_toys_);
-	}
-
-	inline bool Manipulator::parseAlias(const std::string& entry)
-	{
-		const Strings sections = string::split(entry, "|"sv);
 		if(sections.size() != 2)
 		{
 			log::Error("Wrong Alias format. Expected 2 sections, got {}.", sections.size());
 			return false;
 		}
 
-		bool duplicate = false;
-		const auto& alias_info = sections[0];
-		if(aliases_.contains(alias_info))
+		const auto alias_info = sections[0].text;
+		const auto alias_id = symbols_.Intern(alias_info);
+		if(alias_definitions_.Contains(alias_id))
 		{
 			log::Error("Alias {} exists.", alias_info);
 			infos_[ift::ALIASES_DUP]++;
-			duplicate = true;
+			log::Warn("Entry will be omitted due to incorrect Alias name.");
+			return false;
 		}
 
-		const auto& form_lists_info = sections[1];
-		const Strings form_lists_sections = string::split(form_lists_info, ",");
+		alias_definitions_[alias_id].references = sections[1].references;
+		return true;
+	}
+
+	inline const FormsLists* Manipulator::resolveAlias(const SymbolId id)
+	{
+		const auto definition = alias_definitions_.Find(id);
+		if(!definition)
+			return nullptr;
+		if(definition->state == Definition::State::RESOLVED)
+			return aliases_.Find(id);
+
+		definition->state = Definition::State::RESOLVED;
+		const auto alias_info = symbols_.Name(id);
+		const auto& references = definition->references;
+		FormsLists found;
+		resolver_.Resolve(references, found);
+
 		FormsLists form_lists;
 		int missing = 0;
-		for(auto& fs : form_lists_sections)
+		for(std::size_t i = 0; i < references.size(); i++)
 		{
-			auto form_list = FindForm<RE::BGSListForm>(fs);
-			if(!form_list)
+			if(!found[i])
 			{
-				log::Error("Unable to find FormList: {} for Alias.", fs);
+				log::Error("Unable to find FormList: {} for Alias.", references[i]);
 				missing++;
 				continue;
 			}
-			form_lists.emplace_back(form_list);
-		}
-
-		if(duplicate)
-		{
-			log::Warn("Entry will be omitted due to incorrect Alias name.");
-			return false;
+			form_lists.emplace_back(found[i]);
 		}
 
-		if(!form_lists.empty())
-		{
-			aliases_.emplace(std::piecewise_construct, std::forward_as_tuple(alias_info), std::forward_as_tuple(form_lists));
-			if(log::debug_mode)
-				log::Info("FormLists Alias \"{}\" added with {} FormsLists, {} missing FormLists.", alias_info, form_lists.size(), missing);
-		}
-		else
+		if(form_lists.empty())
 		{
 			log::Info("FormLists Alias \"{}\" was omitted because it does not have valid Forms.", alias_info);
-			return false;
+			infos_[ift::ENTRIES_IN]++;
+			return nullptr;
 		}
 
-		return true;
+		infos_[ift::ENTRIES_V]++;
+
+		if(log::debug_mode)
+			log::Info("FormLists Alias \"{}\" added with {} FormsLists, {} missing FormLists.", alias_info, form_lists.size(), missing);
+		return &(aliases_[id] = std::move(form_lists));
 	}
 
-	inline bool Manipulator::parseGroup(const std::string& entry)
+	inline bool Manipulator::parseGroup(const Sections& sections)
 	{
-		const Strings sections = string::split(entry, "|"sv);
 		if(sections.size() != 2)
 		{
 			log::Error("Wrong Group format. Expected 2 sections, got {}.", sections.size());
 			return false;
 		}
 
-		bool duplicate = false;
-		const auto& group_info = sections[0];
+		const auto group_info = sections[0].text;
+		const auto group_id = symbols_.Intern(group_info);
 
-		if(groups_.contains(group_info))
+		if(group_definitions_.Contains(group_id))
 		{
 			log::Error("Group {} exists.", group_info);
 			infos_[ift::GROUPS_DUP]++;
-			duplicate = true;
+			log::Warn("Entry will be omitted due to incorrect Group name.");
+			return false;
 		}
 
-		const auto& forms_info = sections[1];
-		const Strings forms_sections = string::split(forms_info, ",");
+		group_definitions_[group_id].references = sections[1].references;
+		return true;
+	}
+
+	inline SharedForms Manipulator::resolveGroup(const SymbolId id)
+	{
+		const auto definition = group_definitions_.Find(id);
+		if(!definition)
+			return nullptr;
+
+		const auto group_info = symbols_.Name(id);
+		if(definition->state == Definition::State::RESOLVED)
+		{
+			const auto group = groups_.Find(id);
+			return group ? *group : nullptr;
+		}
+		if(definition->state == Definition::State::RESOLVING)
+			return nullptr;
+
+		definition->state = Definition::State::RESOLVING;
+		const auto references = definition->references;
+
 		Forms forms;
 		int missing = 0;
-		for(auto& fs : forms_sections)
+		for(const auto fs : references)
 		{
 			if(fs.starts_with("*"))
 			{
-				std::string tmp = fs;
-				tmp.erase(0, 1);
-				if(const auto form_list = FindForm<RE::BGSListForm>(tmp); !form_list)
+				const auto tmp = fs.substr(1);
+				if(const auto form_list = resolver_.Resolve<RE::BGSListForm>(tmp); !form_list)
 				{
 					log::Error("Unable to find FormList: {}.", tmp);
 					missing++;
@@ -920,21 +1276,37 @@ namespace flm
 			}
 			else if(fs.starts_with("#"))
 			{
-				std::string tmp = fs;
-				tmp.erase(0, 1);
-				if(collections_.contains(tmp))
+				const auto tmp = fs.substr(1);
+				const auto tmp_id = symbols_.Find(tmp);
+				bool not_found = true;
+				if(const auto dependency = group_definitions_.Find(tmp_id); dependency && dependency->state == Definition::State::RESOLVING)
 				{
-					forms.insert(forms.end(), collections_[tmp].begin(), collections_[tmp].end());
+					// A Group still being resolved is reached again through a cycle, it is reported once and is not unknown.
+					log::Error("Group {} uses itself.", tmp);
+					infos_[ift::GROUPS_NE]++;
+					not_found = false;
 				}
-				else
+				else if(const auto group = resolveGroup(tmp_id))
 				{
-					log::Error("Unknown Collection: {}.", tmp);
+					forms.insert(forms.end(), group->begin(), group->end());
+					not_found = false;
+				}
+
+				if(const auto collection = collections_.Find(tmp_id))
+				{
+					forms.insert(forms.end(), (*collection)->begin(), (*collection)->end());
+					not_found = false;
+				}
+
+				if(not_found)
+				{
+					log::Error("Unknown Group/Collection: {}.", tmp);
 					infos_[ift::COLLE_NE]++;
 				}
 			}
 			else
 			{
-				auto form = FindForm(fs);
+				auto form = resolver_.Resolve(fs);
 				if(!form)
 				{
 					log::Error("Unable to find Form: {} for Group.", fs);
@@ -945,39 +1317,86 @@ namespace flm
 			}
 		}
 
-		if(duplicate)
-		{
-			log::Warn("Entry will be omitted due to incorrect Group name.");
-			return false;
-		}
+		definition->state = Definition::State::RESOLVED;
 
-		if(!forms.empty())
-		{
-			groups_.emplace(std::piecewise_construct, std::forward_as_tuple(group_info), std::forward_as_tuple(forms));
-			if(log::debug_mode)
-				log::Info("Forms Group \"{}\" added with {} Forms, {} missing Forms.", group_info, forms.size(), missing);
-		}
-		else
+		if(forms.empty())
 		{
 			log::Info("Forms Group \"{}\" was omitted because it does not have valid Forms.", group_info);
-			return false;
+			infos_[ift::ENTRIES_IN]++;
+			return nullptr;
 		}
 
-		return true;
+		infos_[ift::ENTRIES_V]++;
+
+		if(log::debug_mode)
+			log::Info("Forms Group \"{}\" added with {} Forms, {} missing Forms.", group_info, forms.size(), missing);
+		return groups_[id] = std::make_shared<const Forms>(std::move(forms));
+	}
+
+	inline void Manipulator::finalizePayloads()
+	{
+		int total = 0;
+		const auto compact = [&total](const FormSets& sets)
+		{
+			const int amount = countForms(sets);
+			total += amount;
+
+			FormIds form_ids;
+			Set<RE::FormID> seen;
+			form_ids.reserve(amount);
+			seen.reserve(amount);
+			for(const auto& set : sets)
+				for(const auto form : *set)
+					if(seen.insert(form->GetFormID()).second)
+						form_ids.push_back(form->GetFormID());
+			form_ids.shrink_to_fit();
+			return form_ids;
+		};
+
+		int unique = 0;
+		const auto compact_lists = [&compact, &unique](const FormListsSets& sets, FormListsData& data)
+		{
+			for(const auto& [form_list, list_sets] : sets)
+				unique += static_cast<int>((data[form_list] = compact(list_sets)).size());
+		};
+
+		compact_lists(form_list_sets_, form_lists_);
+		compact_lists(form_list_removal_sets_, form_list_removals_);
+		for(const auto& [event_name, data] : mod_event_sets_)
+			compact_lists(data, mod_events_[event_name]);
+		for(const auto& [event_name, data] : mod_event_removal_sets_)
+			compact_lists(data, mod_event_removals_[event_name]);
+
+		form_list_sets_ = {};
+		form_list_removal_sets_ = {};
+		mod_event_sets_ = {};
+		mod_event_removal_sets_ = {};
+
+		infos_[ift::FORMS_REP] = total - unique;
+		if(log::debug_mode)
+			log::Info("Payloads of FormLists and Mod Events finalized, {} Forms, {} unique, {} repeated removed.", total, unique, infos_[ift::FORMS_REP]);
+	}
+
+	inline int Manipulator::countForms(const FormSets& sets)
+	{
+		int amount = 0;
+		for(const auto& set : sets)
+			amount += static_cast<int>(set->size());
+		return amount;
 	}
 
-	inline bool flm::Manipulator::parseCollection(const std::string& entry)
+	inline bool flm::Manipulator::parseCollection(const Sections& sections)
 	{
-		const Strings sections = string::split(entry, "|"sv);
 		if(sections.size() != 3 && sections.size() != 4)
 		{
 			log::Error("Wrong Collection format. Expected 3 or 4 sections, got {}.", sections.size());
 			return false;
 		}
 
-		const auto& name = sections[0];
+		const auto name = sections[0].text;
+		const auto id = symbols_.Intern(name);
 
-		if(collections_.contains(name) || groups_.contains(name))
+		if(collections_.Contains(id) || groups_.Contains(id))
 		{
 			log::Error("Collection {} exists.", name);
 			infos_[ift::COLLE_DUP]++;
@@ -986,7 +1405,7 @@ namespace flm
 			return false;
 		}
 
-		auto form_type = sections[1];
+		std::string form_type(sections[1].text);
 		ToLower(form_type);
 		if(!FORM_TYPES.contains(form_type))
 		{
@@ -997,13 +1416,12 @@ namespace flm
 			return false;
 		}
 
-		const auto& keywords_info = sections[2];
-		for(const Strings keywords_list = string::split(keywords_info, ","); std::string keyword : keywords_list)
+		for(auto keyword : sections[2].references)
 		{
 			bool remove = false;
-			if(keyword[0] == '-')
+			if(keyword.starts_with('-'))
 			{
-				keyword.erase(0, 1);
+				keyword.remove_prefix(1);
 				remove = true;
 			}
 
@@ -1015,21 +1433,20 @@ namespace flm
             if(found)
 	            form = it->second;
 			else
-                found = (form = FindForm<RE::BGSKeyword>(keyword))!= nullptr;
+                found = (form = resolver_.Resolve<RE::BGSKeyword>(keyword))!= nullptr;
 
 			if(!found)
 			{
 				log::Error("Keyword {} do not exist!", keyword);
-				if(collections_data_.contains(name))
-					collections_data_.erase(name);
+				collections_data_.Erase(id);
 				return false;
 			}
 			else
 			{
 				if(remove)
-					collections_data_[name].second.push_back(form);
+					collections_data_[id].second.push_back(form);
 				else
-					collections_data_[name].first.push_back(form);
+					collections_data_[id].first.push_back(form);
 			}
 		}
 
@@ -1037,10 +1454,11 @@ namespace flm
 			if(const auto res = evaluateFilter(sections[3]); res != 1)
 				return res == 0 ? false : true;
 
-		collections_form_types_[form_type].emplace(name);
-		collections_[name] = {};
+		if(auto& ids = collections_form_types_[form_type]; std::ranges::find(ids, id) == ids.end())
+			ids.push_back(id);
+		collections_[id] = std::make_shared<Forms>();
 		if(log::debug_mode)
-			log::Info("[{}-{}] Collection \"{}\" with [+]{} [-]{} keywords added.", form_type, collections_form_types_[form_type].size(), name, collections_data_[name].first.size(), collections_data_[name].second.size());
+			log::Info("[{}-{}] Collection \"{}\" with [+]{} [-]{} keywords added.", form_type, collections_form_types_[form_type].size(), name, collections_data_[id].first.size(), collections_data_[id].second.size());
 
 		return true;
 	}
@@ -1050,7 +1468,7 @@ namespace flm
 		return addParsedCollection<RE::TESObjectARMO>("armor"sv) &&
 			   addParsedCollection<RE::TESObjectWEAP>("weapon"sv) &&
 			   addParsedCollection<RE::TESAmmo>("ammo"sv) &&
-			   addParsedCollection<RE::TESObjectARMO>("magiceffect"sv) &&
+			   addParsedCollection<RE::EffectSetting>("magiceffect"sv) &&
 			   addParsedCollection<RE::AlchemyItem>("alchemyitem"sv) &&
 			   addParsedCollection<RE::ScrollItem>("scroll"sv) &&
 			   addParsedCollection<RE::BGSLocation>("location"sv) &&
@@ -1088,70 +1506,105 @@ namespace flm
 		if(it == collections_form_types_.end())
 			return true;
 
-		for(RE::TESForm* form : data_handler->GetFormArray<T>())
+		const auto start = std::chrono::steady_clock::now();
+
+		const auto& ids = it->second;
+		std::vector<const KeywordsPairVec*> filters;
+		filters.reserve(ids.size());
+		for(const auto id : ids)
+			if(const auto filter = collections_data_.Find(id))
+				filters.push_back(filter);
+
+		// Keywords are indexed once for the FormType, then every Collection of the type is tested with keyword signatures of Forms.
+		KeywordIndex index;
+		index.Build(data_handler->GetFormArray<T>(), filters);
+
+		// Keyword frequencies of the FormType order every Collection, Collections with a required keyword that never occurs are skipped.
+		std::vector<bool> skipped(ids.size());
+		std::size_t skipped_count = 0;
+		for(std::size_t i = 0; i < ids.size(); i++)
 		{
-			if(!form)
+			const auto filter = collections_data_.Find(ids[i]);
+			if(!filter)
 				continue;
 
-			const auto bgs_keyword_form = form->As<RE::BGSKeywordForm>();
-			Set<RE::BGSKeyword*> form_keywords = { bgs_keyword_form->keywords, bgs_keyword_form->keywords + bgs_keyword_form->numKeywords };
+			skipped[i] = !index.Order(*filter);
+			skipped_count += skipped[i];
+
+			if(log::debug_mode)
+			{
+				log::Info("Collection {}{}", symbols_.Name(ids[i]), skipped[i] ? " skipped, a required keyword never occurs." : ", keywords by selectivity:");
+				log::indent_level++;
+				for(const auto keyword : filter->first)
+					log::Info("+{} in {} Forms", GetEditorId(keyword), index.Occurrences(keyword));
+				for(const auto keyword : filter->second)
+					log::Info("-{} in {} Forms", GetEditorId(keyword), index.Occurrences(keyword));
+				log::indent_level--;
+			}
+		}
+
+		if(log::debug_mode)
+		{
+			std::size_t missing = 0;
+			const auto used = index.UsedKeywords(missing);
+			log::Info("{} collections use {} keywords, {} never occur in {} Forms, {} collections skipped.", formType, used, missing, formType, skipped_count);
+		}
 
-			// if(log::debug_mode)
-			// 	log::Info("[{}] {} >>>> {}", GetEditorId(form), form->GetName(), form_keywords.size());
+		// Collections are matched in parallel into their own slots, so Forms are added in the order of ids.
+		std::vector<std::size_t> slots(ids.size());
+		std::iota(slots.begin(), slots.end(), std::size_t{ 0 });
 
-			if(form_keywords.empty())
+		const auto match_start = std::chrono::steady_clock::now();
+		std::vector<Forms> results(ids.size());
+		std::for_each(std::execution::par, slots.begin(), slots.end(), [&](const std::size_t i)
+		{
+			if(const auto filter = collections_data_.Find(ids[i]); filter && !skipped[i])
+				results[i] = index.Match(*filter);
+		});
+		const auto match_time = std::chrono::steady_clock::now() - match_start;
+
+		if(log::debug_mode)
+			log::Info("{} collections matched in {:.3f} ms.", formType,
+					  static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(match_time).count()) / 1000.0);
+
+		std::size_t matches = 0;
+		for(std::size_t i = 0; i < ids.size(); i++)
+		{
+			const auto id = ids[i];
+			const auto& matched = results[i];
+			if(matched.empty())
 				continue;
 
-			for(const auto& [name, filter_keywords] : collections_data_)
-			{
-				// if(log::debug_mode)
-				// {
-				// 	log::Info("Collection {} [{} | {}]", name, filter_keywords.first.size(), filter_keywords.second.size());
-				// }
-
-				bool add = true;
-
-				if(!filter_keywords.first.empty())
-					for(const auto& k : filter_keywords.first)
-						if(!form_keywords.contains(k))
-						{
-							add = false;
-							break;
-						}
-
-				if(!filter_keywords.second.empty())
-					for(const auto& k : filter_keywords.second)
-						if(form_keywords.contains(k))
-						{
-							add = false;
-							break;
-						}
-
-				if(add)
-				{
-					if(log::debug_mode)
-						log::Info("Collection {} <== [{}] {}", name, GetEditorId(form), form->GetName());
+			matches += matched.size();
 
-					collections_[name].push_back(form);
-				}
-			}
+			if(log::debug_mode)
+				for(const auto form : matched)
+					log::Info("Collection {} <== [{}] {}", symbols_.Name(id), GetEditorId(form), form->GetName());
+
+			auto& collection = collections_[id];
+			if(!collection)
+				collection = std::make_shared<Forms>();
+			collection->insert(collection->end(), matched.begin(), matched.end());
 		}
 
+		log::Info("Matched {} {} Forms to {} collections, {} Forms added in {:.3f} ms.", index.Size(), formType, it->second.size(), matches,
+				  static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()) / 1000.0);
+
 		return true;
 	}
 
-	inline bool Manipulator::parseFilter(const std::string& entry)
+	inline bool Manipulator::parseFilter(const Sections& sections)
 	{
-		const Strings sections = string::split(SanitizeFilter(entry), "|"sv);
 		if(sections.size() != 2)
 		{
 			log::Error("Wrong Filter format. Expected 2 sections, got {}.", sections.size());
 			return false;
 		}
 
-		const std::string& filter_info = sections[0];
+		const auto filter_info = sections[0].text;
+		const auto filter_id = symbols_.Intern(filter_info);
 
-		if(filters_.contains(filter_info))
+		if(filters_.Contains(filter_id))
 		{
 			log::Error("Filter {} exists.", filter_info);
 			infos_[ift::FILTERS_DUP]++;
@@ -1161,7 +1614,7 @@ namespace flm
 
 		if(const int meet_criteria = EvaluateFilter(sections[1]); meet_criteria == 1 || meet_criteria == -1)
 		{
-			filters_.emplace(std::piecewise_construct, std::forward_as_tuple(filter_info), std::forward_as_tuple(meet_criteria == 1 ? true : false));
+			filters_[filter_id] = meet_criteria;
 			if(log::debug_mode)
 				log::Info("Filter \"{}\" added with status {}.", filter_info, meet_criteria == 1 ? true : false);
 		}
@@ -1175,9 +1628,18 @@ namespace flm
 		return true;
 	}
 
-	inline bool Manipulator::parseModEvent(const std::string& entry)
+	inline bool Manipulator::parseModEvent(const Sections& sections)
+	{
+		return parseModEventEntry(sections, mod_event_sets_);
+	}
+
+	inline bool Manipulator::parseModEventRemove(const Sections& sections)
+	{
+		return parseModEventEntry(sections, mod_event_removal_sets_);
+	}
+
+	inline bool Manipulator::parseModEventEntry(const Sections& sections, MapModEventsSets& target)
 	{
-		const Strings sections = string::split(entry, "|"sv);
 		if(sections.size() != 3)
 		{
 			log::Error("Wrong FormList format. Expected 3 sections, got {}.", sections.size());
@@ -1187,7 +1649,7 @@ namespace flm
 
 		bool found_destination = true;
 
-		const auto& event_name = sections[0];
+		const std::string event_name(sections[0].text);
 		if(event_name.empty())
 		{
 			log::Error("The event name is empty, skipping!");
@@ -1202,14 +1664,14 @@ namespace flm
 			return false;
 		}
 
-		auto form_list_info = sections[1];
+		auto form_list_info = sections[1].text;
 		FormsLists form_lists;
 
 		if(form_list_info.starts_with("#"))
 		{
-			form_list_info.erase(0, 1);
-			if(aliases_.contains(form_list_info))
-				form_lists = aliases_[form_list_info];
+			form_list_info.remove_prefix(1);
+			if(const auto alias = resolveAlias(symbols_.Find(form_list_info)))
+				form_lists = *alias;
 			else
 			{
 				log::Error("Unknown Alias: {}.", form_list_info);
@@ -1219,7 +1681,7 @@ namespace flm
 		}
 		else
 		{
-			if(const auto form_list = FindForm<RE::BGSListForm>(form_list_info); !form_list)
+			if(const auto form_list = resolver_.Resolve<RE::BGSListForm>(form_list_info); !form_list)
 			{
 				log::Error("Unable to find FormList: {}.", form_list_info);
 				infos_[ift::FLIST_MIS]++;
@@ -1229,26 +1691,25 @@ namespace flm
 				form_lists.emplace_back(form_list);
 		}
 
-		const auto& forms_info = sections[2];
-		Strings forms_sections = string::split(forms_info, ",");
 		Forms forms;
+		FormSets sets;
 		int missing = 0;
-		for(auto& fs : forms_sections)
-			if(parseFormEntry(fs, forms) == -1)
+		for(const auto fs : sections[2].references)
+			if(parseFormEntry(fs, forms, &sets) == -1)
 				missing++;
+		if(!forms.empty())
+			sets.push_back(std::make_shared<const Forms>(std::move(forms)));
 
 		if(!found_destination)
 			return false;
 
-		infos_[ift::FORMS] += static_cast<int>(forms.size());
+		const int amount = countForms(sets);
+		infos_[ift::FORMS] += amount;
 		infos_[ift::FORMS_MISS] += missing;
 
-		if(!form_lists.empty() && !forms.empty())
+		if(!form_lists.empty() && amount != 0)
 		{
-			if(!mod_events_.contains(event_name))
-				mod_events_.emplace(event_name, FormListsData());
-
-			FormListsData& mod_event_data = mod_events_[event_name];
+			FormListsSets& mod_event_data = target[event_name];
 
 			for(auto& fl : form_lists)
 			{
@@ -1258,12 +1719,10 @@ namespace flm
 							  GetEditorId(fl),
 							  fl->GetName(),
 							  fl->formID,
-							  forms.size(),
+							  amount,
 							  missing);
-				if(mod_event_data.contains(fl))
-					mod_event_data[fl].insert(mod_event_data[fl].end(), forms.begin(), forms.end());
-				else
-					mod_event_data.emplace(std::piecewise_construct, std::forward_as_tuple(fl), std::forward_as_tuple(forms));
+				auto& list_sets = mod_event_data[fl];
+				list_sets.insert(list_sets.end(), sets.begin(), sets.end());
 			}
 			infos_[ift::MODEV]++;
 		}
@@ -1277,29 +1736,15 @@ namespace flm
 		return true;
 	}
 
-	inline bool Manipulator::parseHairColors(const std::string& entry)
-	{
-		return parseList(entry, "Hair Colors", hair_colors_);
-	}
-
-	inline bool Manipulator::parseAtronachForge(const std::string& entry)
-	{
-		return parsePair(entry, std::make_tuple("Atronach Forge"sv, "Recipe"sv, "Result"sv), atronach_forge_);
-	}
-
-	inline bool Manipulator::parseAtronachForgeSigil(const std::string& entry)
-	{
-		return parsePair(entry, std::make_tuple("Atronach Forge with Sigil Stone"sv, "Recipe"sv, "Result"sv), atronach_sigil_forge_);
-	}
-
-	inline bool Manipulator::parseDragonbornSpiderCrafting(const std::string& entry)
+	inline bool Manipulator::parseSimplified(const SimplifiedEntry& entry, const Sections& sections)
 	{
-		return parsePair(entry, std::make_tuple("Dragonborn Spider Crafting"sv, "Recipe"sv, "Result"sv), dragon_spider_crafting_);
+		if(entry.pairs)
+			return parsePair(sections, entry.names, this->*entry.pairs, entry.plant_types_warn);
+		return parseList(sections, std::get<0>(entry.names), this->*entry.forms);
 	}
 
-	inline bool Manipulator::parseList(const std::string entry, const std::string_view entryName, Forms& list)
+	inline bool Manipulator::parseList(const Sections& sections, const std::string_view entryName, Forms& list)
 	{
-		const Strings sections = string::split(entry, "|"sv);
 		if(sections.size() != 1 && sections.size() != 2)
 		{
 			log::Error("Wrong {} format. Expected 1 or 2 sections, got {}.", entryName, sections.size());
@@ -1310,11 +1755,9 @@ namespace flm
 			if(const auto res = evaluateFilter(sections[1]); res != 1)
 				return res == 0 ? false : true;
 
-		const auto& forms_info = sections[0];
-		Strings forms_sections = string::split(forms_info, ",");
 		int amount = 0;
 		int missing = 0;
-		for(auto& fs : forms_sections)
+		for(const auto fs : sections[0].references)
 		{
 			if(const int res = parseFormEntry(fs, list); res == -1)
 				missing++;
@@ -1329,9 +1772,8 @@ namespace flm
 		return true;
 	}
 
-	inline bool Manipulator::parsePair(const std::string& entry, const PairEntryNames& names, FormsPairs& list, const bool plantTypesWarn)
+	inline bool Manipulator::parsePair(const Sections& sections, const PairEntryNames& names, FormIdPairs& list, const bool plantTypesWarn)
 	{
-		const Strings sections = string::split(entry, "|"sv);
 		if(sections.size() != 2 && sections.size() != 3)
 		{
 			log::Error("Wrong {} format. Expected 2 or 3 sections, got {}.", std::get<0>(names), sections.size());
@@ -1342,16 +1784,16 @@ namespace flm
 			if(const auto res = evaluateFilter(sections[2]); res != 1)
 				return res == 0 ? false : true;
 
-		const auto& first_info = sections[0];
-		const auto first = FindForm(first_info);
+		const auto first_info = sections[0].text;
+		const auto first = resolver_.Resolve(first_info);
 		if(!first)
 		{
 			log::Error("Unable to find {}: {}.", std::get<1>(names), first_info);
 			infos_[ift::FORMS_MISS]++;
 		}
 
-		const auto& second_info = sections[1];
-		const auto second = FindForm(second_info);
+		const auto second_info = sections[1].text;
+		const auto second = resolver_.Resolve(second_info);
 		if(!second)
 		{
 			log::Error("Unable to find {}: {}.", std::get<2>(names), second_info);
@@ -1374,78 +1816,78 @@ namespace flm
 			log::Info(R"(Found {} "{}" [{:X}], {} "{}" [{:X}].)", std::get<1>(names), first->GetName(), first->formID, std::get<2>(names), second->GetName(), second->formID);
 
 		infos_[ift::FORMS] += 2;
-		list.emplace_back(first, second);
-		return true;
-	}
-
-	inline bool Manipulator::addFormToFormList(RE::BGSListForm*& list, RE::TESForm* form) const
-	{
-		if(list->HasForm(form))
-		{
-			if(log::operating_mode == OperatingMode::INITIALIZE && log::debug_mode)
-				log::DuplicateWarn("Form"sv, form);
-			return false;
-		}
-
-		list->AddForm(form);
-		log::Info("Form {} \"{}\" [{:X}]  added!", GetEditorId(form), form->GetName(), form->formID);
-
+		list.first.push_back(first->GetFormID());
+		list.second.push_back(second->GetFormID());
 		return true;
 	}
 
-	inline int Manipulator::evaluateFilter(const std::string& filter)
+	inline int Manipulator::evaluateFilter(const Section& filter)
 	{
 		int meet_criteria;
-		if(filter[0] == '#')
+		if(filter.text.starts_with('#'))
 		{
-			auto filter_name = filter.substr(1);
-			ToLower(filter_name);
-			if(filters_.contains(filter_name))
-				meet_criteria = filters_[filter_name] ? 1 : -1;
+			filter_name_.assign(filter.text.substr(1));
+			ToLower(filter_name_);
+			if(const auto meet = filters_.Find(symbols_.Find(filter_name_)))
+				meet_criteria = *meet;
 			else
 			{
-				log::Error("Filter {} was not found!", filter_name);
+				log::Error("Filter {} was not found!", filter_name_);
 				meet_criteria = 0;
 			}
 		}
 		else
-			meet_criteria = EvaluateFilter(SanitizeFilter(filter));
+			meet_criteria = EvaluateFilter(filter);
 
 		if(meet_criteria == 1)
 		{
 			if(log::debug_mode)
-				log::Info("Filter \"{}\" is valid", filter);
+				log::Info("Filter \"{}\" is valid", filter.text);
 		}
 		else if(meet_criteria == -1)
 		{
 			if(log::debug_mode)
-				log::Info("Filter \"{}\" does not meet the conditions.", filter);
+				log::Info("Filter \"{}\" does not meet the conditions.", filter.text);
 			infos_[ift::ENTRIES_FO]++;
 		}
 		else if(meet_criteria == 0)
 		{
 			infos_[ift::FILTERS_NE]++;
-			log::Warn("Filter \"{}\" was omitted because it is invalid.", filter);
+			log::Warn("Filter \"{}\" was omitted because it is invalid.", filter.text);
 		}
 
 		return meet_criteria;
 	}
 
-	inline int Manipulator::parseFormEntry(std::string& entry, Forms& forms)
+	inline int Manipulator::parseFormEntry(std::string_view entry, Forms& forms, FormSets* sets)
 	{
 		if(entry.starts_with("#"))
 		{
 			bool not_found = true;
-			entry.erase(0, 1);
-			if(groups_.contains(entry))
+			entry.remove_prefix(1);
+			const auto id = symbols_.Find(entry);
+			const auto share = [&forms, sets](const SharedForms& set)
+			{
+				if(!sets)
+				{
+					forms.insert(forms.end(), set->begin(), set->end());
+					return;
+				}
+				if(!forms.empty())
+					sets->push_back(std::make_shared<const Forms>(std::move(forms)));
+				forms.clear();
+				sets->push_back(set);
+			};
+
+			if(const auto group = resolveGroup(id))
 			{
-				forms.insert(forms.end(), groups_[entry].begin(), groups_[entry].end());
+				share(group);
 				not_found = false;
 			}
 
-			if(collections_.contains(entry))
+			if(const auto collection = collections_.Find(id))
 			{
-				forms.insert(forms.end(), collections_[entry].begin(), collections_[entry].end());
+				share(*collection);
 				not_found = false;
 			}
 
@@ -1459,8 +1901,8 @@ namespace flm
 		}
 		else if(entry.starts_with("*"))
 		{
-			entry.erase(0, 1);
-			if(const auto form_list = FindForm<RE::BGSListForm>(entry); !form_list)
+			entry.remove_prefix(1);
+			if(const auto form_list = resolver_.Resolve<RE::BGSListForm>(entry); !form_list)
 			{
 				log::Error("Unable to find FormList: {}.", entry);
 				return -1;
@@ -1473,7 +1915,7 @@ namespace flm
 		}
 		else
 		{
-			auto form = FindForm(entry);
+			auto form = resolver_.Resolve(entry);
 			if(!form)
 			{
 				log::Error("Unable to find Form: {}.", entry);
@@ -16,20 +16,22 @@ namespace papyrus
 	}
 
 	/**
-	 * \brief Returns debug mode state.
+	 * \brief Returns debug mode state. Waits until configs are processed, because they may enable the debug mode.
 	 * \return                  - Debug mode state.
 	 */
 	static bool DebugMode(RE::StaticFunctionTag*)
 	{
+		flm::manipulator.WaitFound();
 		return flm::log::debug_mode;
 	}
 
 	/**
-	 * \brief Sets debug mode state.
+	 * \brief Sets debug mode state. Waits until configs are processed, so the mode does not change in the middle of processing.
 	 * \param mode              - New debug mode state.
 	 */
 	static void SetDebugMode(RE::StaticFunctionTag*, bool mode)
 	{
+		flm::manipulator.WaitFound();
 		flm::log::debug_mode = mode;
 	}
 
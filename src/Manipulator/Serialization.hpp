@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Manipulator.hpp"
+
+namespace serialization
+{
+	inline constexpr std::uint32_t unique_id = 'FLM_'; /* ID of the plugin in the cosave. */
+
+	/**
+	 * \brief Writes the state of FLM to the cosave when the game is saved.
+	 * \param serialization     - SKSE serialization interface.
+	 */
+	inline void Save(SKSE::SerializationInterface* serialization)
+	{
+		flm::manipulator.Save(serialization);
+	}
+
+	/**
+	 * \brief Reads the state of FLM from the cosave when the game is loaded.
+	 * \param serialization     - SKSE serialization interface.
+	 */
+	inline void Load(SKSE::SerializationInterface* serialization)
+	{
+		flm::manipulator.Load(serialization);
+	}
+
+	/**
+	 * \brief Forgets the state of the current game, before a new game starts or another save is loaded.
+	 */
+	inline void Revert(SKSE::SerializationInterface*)
+	{
+		flm::manipulator.Revert();
+	}
+
+	/**
+	 * \brief Registers cosave callbacks.
+	 */
+	inline void RegisterCallbacks()
+	{
+		const auto serialization = SKSE::GetSerializationInterface();
+		serialization->SetUniqueID(unique_id);
+		serialization->SetSaveCallback(Save);
+		serialization->SetLoadCallback(Load);
+		serialization->SetRevertCallback(Revert);
+	}
+}
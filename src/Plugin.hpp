@@ -7,7 +7,11 @@
 #include "SKSE/SKSE.h"
 
 #include <REL/Relocation.h>
-#include <boost/regex.hpp>
+#include <atomic>
+#include <chrono>
+#include <execution>
+#include <fstream>
+#include <future>
 #include <string_view>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <ClibUtil/utils.hpp>
@@ -0,0 +1,381 @@
+#pragma once
+
+#include "Utility/LogInfo.hpp"
+#include "Utility/Types/ConfigEntry.hpp"
+
+namespace flm
+{
+	/**
+	 * \brief Binary cache of tokenized config files, stored next to the logs.
+	 * The cache is valid only for the same format version and the same plugin list, each file is valid only for the same bytes.
+	 * Records have fixed size and use offsets instead of pointers, so the whole cache is loaded with one read and used in place.
+	 */
+	class ConfigCache
+	{
+		public:
+			/**
+			 * \brief Loads the cache from the disk. The cache stays empty if it is missing, outdated or was made for other plugins.
+			 * Records of files with tokens outside of their buffer or indices outside of their vectors are dropped.
+			 * \param plugins               - Hash of the plugin list.
+			 */
+			void Load(std::uint64_t plugins);
+
+			/**
+			 * \brief Restores tokens of the config file from the cache.
+			 * \param config                - Config file with path and hash set.
+			 * \return                      - True, if the file was found in the cache and has not changed.
+			 */
+			bool Restore(ConfigFile& config) const;
+
+			/**
+			 * \brief Writes tokens of all loaded config files to the disk, replacing the old cache.
+			 * \param configs               - Config files to store.
+			 */
+			void Store(const ConfigFiles& configs) const;
+
+			/**
+			 * \brief Returns the hash of the bytes of a config file.
+			 * \param bytes                 - Content of the file.
+			 * \return                      - Hash of the content.
+			 */
+			static std::uint64_t Hash(std::string_view bytes);
+
+			/**
+			 * \brief Returns the hash of the active plugin list, in load order.
+			 * \return                      - Hash of the plugin list.
+			 */
+			static std::uint64_t HashPlugins();
+
+		private:
+			static constexpr std::uint32_t magic = 0x434D4C46; /* "FLMC". */
+			static constexpr std::uint32_t version = 2;        /* Version of the format, must change when tokens change. */
+
+			struct Header
+			{
+				std::uint32_t magic;   /* Always "FLMC". */
+				std::uint32_t version; /* Version of the format. */
+				std::uint64_t plugins; /* Hash of the plugin list. */
+				std::uint32_t files;   /* Amount of cached config files. */
+				std::uint32_t padding; /* Unused. */
+			};
+
+			/**
+			 * \brief Config file record. Followed by path, buffer, references, sections and entries, each aligned to 8 bytes.
+			 */
+			struct FileRecord
+			{
+				std::uint64_t hash;       /* Hash of the bytes of the config file. */
+				std::uint32_t path;       /* Length of the path. */
+				std::uint32_t buffer;     /* Length of the buffer. */
+				std::uint32_t references; /* Amount of references. */
+				std::uint32_t sections;   /* Amount of sections. */
+				std::uint32_t entries;    /* Amount of entries. */
+				std::uint32_t padding;    /* Unused. */
+			};
+
+			struct TokenRecord
+			{
+				std::uint32_t offset; /* Offset in the buffer. */
+				std::uint32_t size;   /* Length of the token. */
+			};
+
+			struct SectionRecord
+			{
+				TokenRecord text;    /* Whole section. */
+				std::uint32_t first; /* Index of the first reference. */
+				std::uint32_t count; /* Amount of references. */
+			};
+
+			struct EntryRecord
+			{
+				std::int32_t type;   /* Kind of the entry. */
+				std::int32_t line;   /* Position of the entry in the config file. */
+				TokenRecord key;     /* Key. */
+				TokenRecord value;   /* Sanitized value. */
+				std::uint32_t first; /* Index of the first section. */
+				std::uint32_t count; /* Amount of sections. */
+			};
+
+			std::vector<char> data_;           /* Content of the cache file. */
+			StringMap<std::size_t> files_;     /* Path of the config file - offset of its record. */
+			std::uint64_t plugins_ = 0;        /* Hash of the plugin list. */
+
+			/**
+			 * \brief Returns the path of the cache file.
+			 * \return                      - Path of the cache file, empty if the log directory is unknown.
+			 */
+			static std::filesystem::path path();
+
+			/**
+			 * \brief Returns the size of a block aligned to 8 bytes.
+			 * \param size                  - Size of the block.
+			 * \return                      - Aligned size.
+			 */
+			static std::size_t align(std::size_t size);
+
+			/**
+			 * \brief Returns the size of the file record with all its blocks.
+			 * \param record                - File record.
+			 * \return                      - Size of the file record with all its blocks.
+			 */
+			static std::size_t recordSize(const FileRecord& record);
+
+			/**
+			 * \brief Checks that all tokens lie in the buffer and all sections and entries point into their vectors.
+			 * \param offset                - Offset of the file record, the whole record must be in the cache.
+			 * \return                      - True, if the record can be restored.
+			 */
+			[[nodiscard]] bool valid(std::size_t offset) const;
+	};
+
+	inline void ConfigCache::Load(const std::uint64_t plugins)
+	{
+		plugins_ = plugins;
+		data_.clear();
+		files_.clear();
+
+		const auto file_path = path();
+		std::error_code error;
+		const auto size = std::filesystem::file_size(file_path, error);
+		if(error || size < sizeof(Header))
+			return;
+
+		std::ifstream file(file_path, std::ios::binary);
+		data_.resize(size);
+		if(!file.read(data_.data(), static_cast<std::streamsize>(size)))
+		{
+			data_.clear();
+			return;
+		}
+
+		Header header{};
+		std::memcpy(&header, data_.data(), sizeof(Header));
+		if(header.magic != magic || header.version != version || header.plugins != plugins_)
+		{
+			data_.clear();
+			return;
+		}
+
+		std::size_t offset = sizeof(Header);
+		for(std::uint32_t i = 0; i < header.files; i++)
+		{
+			FileRecord record{};
+			if(offset + sizeof(FileRecord) > data_.size())
+				break;
+			std::memcpy(&record, data_.data() + offset, sizeof(FileRecord));
+
+			const auto size_record = recordSize(record);
+			if(offset + size_record > data_.size())
+				break;
+
+			std::string config_path(data_.data() + offset + sizeof(FileRecord), record.path);
+			if(valid(offset))
+				files_.emplace(std::move(config_path), offset);
+			else
+				log::Warn("Cache of config {} is corrupted, the file will be read again.", config_path);
+			offset += size_record;
+		}
+	}
+
+	inline bool ConfigCache::Restore(ConfigFile& config) const
+	{
+		const auto it = files_.find(config.path);
+		if(it == files_.end())
+			return false;
+
+		const char* data = data_.data() + it->second;
+		FileRecord record{};
+		std::memcpy(&record, data, sizeof(FileRecord));
+		if(record.hash != config.hash)
+			return false;
+
+		data += sizeof(FileRecord) + align(record.path);
+		config.buffer.assign(data, data + record.buffer);
+		data += align(record.buffer);
+
+		const std::string_view buffer(config.buffer.data(), config.buffer.size());
+		config.references.resize(record.references);
+		for(auto& reference : config.references)
+		{
+			TokenRecord token{};
+			std::memcpy(&token, data, sizeof(TokenRecord));
+			reference = buffer.substr(token.offset, token.size);
+			data += sizeof(TokenRecord);
+		}
+
+		config.sections.resize(record.sections);
+		for(auto& section : config.sections)
+		{
+			SectionRecord section_record{};
+			std::memcpy(&section_record, data, sizeof(SectionRecord));
+			section.text = buffer.substr(section_record.text.offset, section_record.text.size);
+			section.references = References(config.references.data() + section_record.first, section_record.count);
+			data += sizeof(SectionRecord);
+		}
+
+		config.entries.resize(record.entries);
+		for(auto& entry : config.entries)
+		{
+			EntryRecord entry_record{};
+			std::memcpy(&entry_record, data, sizeof(EntryRecord));
+			entry.type = static_cast<EntryType::EntryType>(entry_record.type);
+			entry.line = entry_record.line;
+			entry.key = buffer.substr(entry_record.key.offset, entry_record.key.size);
+			entry.value = buffer.substr(entry_record.value.offset, entry_record.value.size);
+			entry.sections = Sections(config.sections.data() + entry_record.first, entry_record.count);
+			data += sizeof(EntryRecord);
+		}
+
+		config.loaded = true;
+		config.cached = true;
+		return true;
+	}
+
+	inline void ConfigCache::Store(const ConfigFiles& configs) const
+	{
+		const auto file_path = path();
+		if(file_path.empty())
+			return;
+
+		std::vector<char> data;
+		const auto write = [&data](const void* source, const std::size_t size)
+		{
+			const auto begin = static_cast<const char*>(source);
+			data.insert(data.end(), begin, begin + size);
+			data.resize(data.size() + align(size) - size);
+		};
+
+		Header header{ magic, version, plugins_, 0, 0 };
+		data.resize(sizeof(Header));
+
+		for(const auto& config : configs)
+		{
+			if(!config.loaded)
+				continue;
+
+			const auto token = [&config](const std::string_view text)
+			{
+				return TokenRecord{ static_cast<std::uint32_t>(text.data() - config.buffer.data()), static_cast<std::uint32_t>(text.size()) };
+			};
+
+			FileRecord record{ config.hash, static_cast<std::uint32_t>(config.path.size()), static_cast<std::uint32_t>(config.buffer.size()),
+				static_cast<std::uint32_t>(config.references.size()), static_cast<std::uint32_t>(config.sections.size()), static_cast<std::uint32_t>(config.entries.size()), 0 };
+			write(&record, sizeof(FileRecord));
+			write(config.path.data(), config.path.size());
+			write(config.buffer.data(), config.buffer.size());
+
+			for(const auto reference : config.references)
+			{
+				const auto reference_record = token(reference);
+				data.insert(data.end(), reinterpret_cast<const char*>(&reference_record), reinterpret_cast<const char*>(&reference_record) + sizeof(TokenRecord));
+			}
+
+			for(const auto& section : config.sections)
+			{
+				const SectionRecord section_record{ token(section.text), static_cast<std::uint32_t>(section.references.data() - config.references.data()), static_cast<std::uint32_t>(section.references.size()) };
+				data.insert(data.end(), reinterpret_cast<const char*>(&section_record), reinterpret_cast<const char*>(&section_record) + sizeof(SectionRecord));
+			}
+
+			for(const auto& entry : config.entries)
+			{
+				const EntryRecord entry_record{ static_cast<std::int32_t>(entry.type), entry.line, token(entry.key), token(entry.value),
+					static_cast<std::uint32_t>(entry.sections.data() - config.sections.data()), static_cast<std::uint32_t>(entry.sections.size()) };
+				data.insert(data.end(), reinterpret_cast<const char*>(&entry_record), reinterpret_cast<const char*>(&entry_record) + sizeof(EntryRecord));
+			}
+			data.resize(align(data.size()));
+
+			header.files++;
+		}
+
+		std::memcpy(data.data(), &header, sizeof(Header));
+
+		std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+		file.write(data.data(), static_cast<std::streamsize>(data.size()));
+	}
+
+	inline std::uint64_t ConfigCache::Hash(const std::string_view bytes)
+	{
+		return ankerl::unordered_dense::hash<std::string_view>{}(bytes);
+	}
+
+	inline std::uint64_t ConfigCache::HashPlugins()
+	{
+		const auto data_handler = RE::TESDataHandler::GetSingleton();
+		if(!data_handler)
+			return 0;
+
+		std::string plugins;
+		for(const auto files : { &data_handler->compiledFileCollection.files, &data_handler->compiledFileCollection.smallFiles })
+			for(const auto file : *files)
+				if(file)
+				{
+					plugins += file->GetFilename();
+					plugins += '\n';
+				}
+
+		return Hash(plugins);
+	}
+
+	inline std::filesystem::path ConfigCache::path()
+	{
+		auto directory = logger::log_directory();
+		if(!directory)
+			return {};
+
+		*directory /= fmt::format("{}.cache"sv, Plugin::NAME);
+		return *directory;
+	}
+
+	inline std::size_t ConfigCache::align(const std::size_t size)
+	{
+		return (size + 7) & ~static_cast<std::size_t>(7);
+	}
+
+	inline std::size_t ConfigCache::recordSize(const FileRecord& record)
+	{
+		return sizeof(FileRecord) + align(record.path) + align(record.buffer) + record.references * sizeof(TokenRecord) + record.sections * sizeof(SectionRecord) +
+			   align(record.entries * sizeof(EntryRecord));
+	}
+
+	inline bool ConfigCache::valid(const std::size_t offset) const
+	{
+		FileRecord record{};
+		std::memcpy(&record, data_.data() + offset, sizeof(FileRecord));
+		const char* data = data_.data() + offset + sizeof(FileRecord) + align(record.path) + align(record.buffer);
+
+		const auto in_buffer = [&record](const TokenRecord& token)
+		{
+			return token.offset <= record.buffer && token.size <= record.buffer - token.offset;
+		};
+		const auto in_range = [](const std::uint32_t first, const std::uint32_t count, const std::uint32_t size)
+		{
+			return first <= size && count <= size - first;
+		};
+
+		for(std::uint32_t i = 0; i < record.references; i++, data += sizeof(TokenRecord))
+		{
+			TokenRecord token{};
+			std::memcpy(&token, data, sizeof(TokenRecord));
+			if(!in_buffer(token))
+				return false;
+		}
+
+		for(std::uint32_t i = 0; i < record.sections; i++, data += sizeof(SectionRecord))
+		{
+			SectionRecord section{};
+			std::memcpy(&section, data, sizeof(SectionRecord));
+			if(!in_buffer(section.text) || !in_range(section.first, section.count, record.references))
+				return false;
+		}
+
+		for(std::uint32_t i = 0; i < record.entries; i++, data += sizeof(EntryRecord))
+		{
+			EntryRecord entry{};
+			std::memcpy(&entry, data, sizeof(EntryRecord));
+			if(entry.type < 0 || entry.type >= EntryType::ALL || !in_buffer(entry.key) || !in_buffer(entry.value) || !in_range(entry.first, entry.count, record.sections))
+				return false;
+		}
+
+		return true;
+	}
+}
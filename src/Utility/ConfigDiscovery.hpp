@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Types/Types.hpp"
+
+namespace flm
+{
+	inline constexpr auto config_manifest = R"(Data\SKSE\Plugins\FormListManipulator_Configs.txt)"sv; /* Optional list of configs, one path relative to Data per line. */
+	inline constexpr auto debug_toggle = "FormListManipulator_DEBUG.ini"sv;                          /* File that enables debug mode. */
+	inline constexpr auto async_toggle = "FormListManipulator_ASYNC.ini"sv;                          /* File that enables asynchronous mode. */
+
+	/**
+	 * \brief Config files and toggles found in the Data directory.
+	 */
+	struct ConfigDiscovery
+	{
+		Strings configs;                  /* Paths to the config files, in processing order. */
+		bool debug_mode = false;          /* True, if the debug toggle was found. */
+		bool async_mode = false;          /* True, if the asynchronous mode toggle was found. */
+		bool manifest = false;            /* True, if the configs were listed by the manifest. */
+		std::chrono::microseconds time{}; /* Time spent on discovery. */
+	};
+
+	/**
+	 * \brief Compares file names. Not case-sensitive, as file names on Windows.
+	 * \param a             - First name.
+	 * \param b             - Second name.
+	 * \return              - True, if the names are equal.
+	 */
+	inline bool SameFileName(const std::string_view a, const std::string_view b)
+	{
+		return std::ranges::equal(a, b, [](const unsigned char x, const unsigned char y)
+								  { return std::tolower(x) == std::tolower(y); });
+	}
+
+	/**
+	 * \brief Reads paths to configs from the manifest.
+	 * \param configs       - Vector, where the paths will be added.
+	 * \return              - True, if the manifest exists.
+	 */
+	inline bool ReadManifest(Strings& configs)
+	{
+		std::ifstream manifest{ std::string(config_manifest) };
+		if(!manifest)
+			return false;
+
+		for(std::string line; std::getline(manifest, line);)
+		{
+			const auto begin = line.find_first_not_of(" \t\r");
+			if(begin == std::string::npos || line[begin] == ';' || line[begin] == '#')
+				continue;
+			const auto end = line.find_last_not_of(" \t\r");
+			configs.push_back(R"(Data\)" + line.substr(begin, end - begin + 1));
+		}
+
+		return true;
+	}
+
+	/**
+	 * \brief Reads the directory once and passes every file with .ini extension to the callback.
+	 * \param folder        - Directory to read.
+	 * \param callback      - Function called with the directory entry of every .ini file.
+	 */
+	inline void ForEachIni(const std::string_view folder, const std::function<void(const std::filesystem::directory_entry&)>& callback)
+	{
+		std::error_code error;
+		for(auto iterator = std::filesystem::directory_iterator(folder, error); !error && iterator != std::filesystem::directory_iterator(); iterator.increment(error))
+			if(const auto& path = iterator->path(); !path.empty() && path.extension() == ".ini"sv)
+				callback(*iterator);
+	}
+
+	/**
+	 * \brief Finds configs and toggles. Data and Data\FLM directories are read only once, or not at all if the manifest exists.
+	 * The result is found on the first call and reused later.
+	 * \return              - Found configs and state of the toggles.
+	 */
+	inline const ConfigDiscovery& DiscoverConfigs()
+	{
+		static const ConfigDiscovery discovery = []
+		{
+			const auto start = std::chrono::steady_clock::now();
+			ConfigDiscovery result;
+
+			if(ReadManifest(result.configs))
+			{
+				result.manifest = true;
+				result.debug_mode = std::filesystem::exists(fmt::format(R"(Data\{})", debug_toggle)) || std::filesystem::exists(fmt::format(R"(Data\FLM\{})", debug_toggle));
+				result.async_mode = std::filesystem::exists(fmt::format(R"(Data\{})", async_toggle)) || std::filesystem::exists(fmt::format(R"(Data\FLM\{})", async_toggle));
+			}
+			else
+			{
+				ForEachIni(R"(Data\)", [&result](const std::filesystem::directory_entry& entry)
+						   {
+							   const auto name = entry.path().filename().string();
+							   if(SameFileName(name, debug_toggle))
+								   result.debug_mode = true;
+							   else if(SameFileName(name, async_toggle))
+								   result.async_mode = true;
+							   else if(name.find("_FLM"sv) != std::string::npos)
+								   result.configs.push_back(entry.path().string());
+						   });
+				std::ranges::sort(result.configs);
+
+				ForEachIni(R"(Data\FLM)", [&result](const std::filesystem::directory_entry& entry)
+						   {
+							   const auto name = entry.path().filename().string();
+							   if(SameFileName(name, debug_toggle))
+								   result.debug_mode = true;
+							   else if(SameFileName(name, async_toggle))
+								   result.async_mode = true;
+							   else
+								   result.configs.push_back(entry.path().string());
+						   });
+			}
+
+			if(!result.debug_mode)
+				result.debug_mode = std::filesystem::exists(fmt::format(R"(Data\SKSE\Plugins\{})", debug_toggle));
+			if(!result.async_mode)
+				result.async_mode = std::filesystem::exists(fmt::format(R"(Data\SKSE\Plugins\{})", async_toggle));
+
+			result.time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			return result;
+		}();
+
+		return discovery;
+	}
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "Types/Types.hpp"
+
+namespace flm
+{
+	/**
+	 * \brief Case-insensitive index of EditorIDs of all Forms, built once after the data is loaded.
+	 * Two open addressing tables with linear probing map EditorIDs to Forms and FormIDs to EditorIDs.
+	 * All EditorIDs are stored in one arena, slots keep only offsets into it.
+	 */
+	class EditorIdIndex
+	{
+		public:
+			/**
+			 * \brief Builds the index from all Forms that have EditorIDs.
+			 */
+			void Build();
+
+			/**
+			 * \brief Checks whether the index was built.
+			 * \return                      - True, if the index was built.
+			 */
+			[[nodiscard]] bool Built() const;
+
+			/**
+			 * \brief Returns the Form with the EditorID.
+			 * \param editorId              - EditorID of the Form. Not case-sensitive.
+			 * \return                      - Form pointer or nullptr if not found.
+			 */
+			[[nodiscard]] RE::TESForm* Find(std::string_view editorId) const;
+
+			/**
+			 * \brief Returns the EditorID of the Form.
+			 * \param formId                - FormID of the Form.
+			 * \return                      - EditorID or empty string if not found.
+			 */
+			[[nodiscard]] std::string_view Find(RE::FormID formId) const;
+
+			/**
+			 * \brief Returns the amount of indexed EditorIDs.
+			 * \return                      - Amount of indexed EditorIDs.
+			 */
+			[[nodiscard]] std::size_t Size() const;
+
+		private:
+			struct NameSlot
+			{
+				RE::TESForm* form = nullptr; /* Form, nullptr if the slot is empty. */
+				std::uint32_t offset = 0;    /* Offset of the EditorID in the arena. */
+				std::uint32_t size = 0;      /* Length of the EditorID. */
+			};
+
+			struct IdSlot
+			{
+				RE::FormID form_id = 0;   /* FormID, 0 if the slot is empty. */
+				std::uint32_t offset = 0; /* Offset of the EditorID in the arena. */
+				std::uint32_t size = 0;   /* Length of the EditorID. */
+			};
+
+			std::vector<char> arena_;      /* All EditorIDs, one after another. */
+			std::vector<NameSlot> names_;  /* EditorID - Form. */
+			std::vector<IdSlot> ids_;      /* FormID - EditorID. */
+			std::size_t size_ = 0;         /* Amount of indexed EditorIDs. */
+			bool built_ = false;           /* True, if the index was built. */
+
+			/**
+			 * \brief Returns the text stored in the arena.
+			 * \param offset                - Offset of the text.
+			 * \param size                  - Length of the text.
+			 * \return                      - Text from the arena.
+			 */
+			[[nodiscard]] std::string_view text(std::uint32_t offset, std::uint32_t size) const;
+
+			/**
+			 * \brief Returns case-insensitive hash of the EditorID (FNV-1a of lowercase characters).
+			 * \param editorId              - EditorID to hash.
+			 * \return                      - Hash of the EditorID.
+			 */
+			static std::uint64_t hash(std::string_view editorId);
+
+			/**
+			 * \brief Returns the hash of the FormID.
+			 * \param formId                - FormID to hash.
+			 * \return                      - Hash of the FormID.
+			 */
+			static std::uint64_t hash(RE::FormID formId);
+
+			/**
+			 * \brief Compares EditorIDs. Not case-sensitive.
+			 * \param a                     - First EditorID.
+			 * \param b                     - Second EditorID.
+			 * \return                      - True, if EditorIDs are equal.
+			 */
+			static bool equal(std::string_view a, std::string_view b);
+	};
+
+	inline EditorIdIndex editor_ids; /* EditorIDs of all Forms. */
+
+	inline void EditorIdIndex::Build()
+	{
+		const auto [map, lock] = RE::TESForm::GetAllFormsByEditorID();
+		if(!map)
+			return;
+
+		const RE::BSReadLockGuard locker{ lock };
+
+		std::size_t capacity = 16;
+		while(capacity < static_cast<std::size_t>(map->size()) * 2)
+			capacity <<= 1;
+
+		arena_.clear();
+		names_.assign(capacity, {});
+		ids_.assign(capacity, {});
+		size_ = 0;
+
+		const std::size_t mask = capacity - 1;
+		for(const auto& [editor_id, form] : *map)
+		{
+			const std::string_view name = editor_id;
+			if(!form || name.empty())
+				continue;
+
+			const auto offset = static_cast<std::uint32_t>(arena_.size());
+			const auto size = static_cast<std::uint32_t>(name.size());
+
+			auto slot = hash(name) & mask;
+			while(names_[slot].form && !equal(text(names_[slot].offset, names_[slot].size), name))
+				slot = (slot + 1) & mask;
+			if(names_[slot].form)
+				continue;
+
+			arena_.insert(arena_.end(), name.begin(), name.end());
+			names_[slot] = { form, offset, size };
+			size_++;
+
+			if(const auto form_id = form->GetFormID(); form_id != 0)
+			{
+				slot = hash(form_id) & mask;
+				while(ids_[slot].form_id != 0 && ids_[slot].form_id != form_id)
+					slot = (slot + 1) & mask;
+				if(ids_[slot].form_id == 0)
+					ids_[slot] = { form_id, offset, size };
+			}
+		}
+
+		built_ = true;
+	}
+
+	inline bool EditorIdIndex::Built() const
+	{
+		return built_;
+	}
+
+	inline RE::TESForm* EditorIdIndex::Find(const std::string_view editorId) const
+	{
+		if(names_.empty())
+			return nullptr;
+
+		const std::size_t mask = names_.size() - 1;
+		for(auto slot = hash(editorId) & mask; names_[slot].form; slot = (slot + 1) & mask)
+			if(equal(text(names_[slot].offset, names_[slot].size), editorId))
+				return names_[slot].form;
+
+		return nullptr;
+	}
+
+	inline std::string_view EditorIdIndex::Find(const RE::FormID formId) const
+	{
+		if(ids_.empty() || formId == 0)
+			return {};
+
+		const std::size_t mask = ids_.size() - 1;
+		for(auto slot = hash(formId) & mask; ids_[slot].form_id != 0; slot = (slot + 1) & mask)
+			if(ids_[slot].form_id == formId)
+				return text(ids_[slot].offset, ids_[slot].size);
+
+		return {};
+	}
+
+	inline std::size_t EditorIdIndex::Size() const
+	{
+		return size_;
+	}
+
+	inline std::string_view EditorIdIndex::text(const std::uint32_t offset, const std::uint32_t size) const
+	{
+		return { arena_.data() + offset, size };
+	}
+
+	inline std::uint64_t EditorIdIndex::hash(const std::string_view editorId)
+	{
+		std::uint64_t result = 0xcbf29ce484222325;
+		for(const unsigned char c : editorId)
+		{
+			result ^= static_cast<std::uint64_t>(std::tolower(c));
+			result *= 0x100000001b3;
+		}
+		return result;
+	}
+
+	inline std::uint64_t EditorIdIndex::hash(const RE::FormID formId)
+	{
+		return ankerl::unordered_dense::hash<RE::FormID>{}(formId);
+	}
+
+	inline bool EditorIdIndex::equal(const std::string_view a, const std::string_view b)
+	{
+		return std::ranges::equal(a, b, [](const unsigned char x, const unsigned char y)
+								  { return std::tolower(x) == std::tolower(y); });
+	}
+}
@@ -3,6 +3,7 @@
 #undef MessageBox
 #undef GetModuleHandle
 #include "Types/Types.hpp"
+#include "Utility/EditorIdIndex.hpp"
 
 namespace winApi = SKSE::WinAPI;
 
@@ -12,12 +13,15 @@ namespace flm
 	inline winApi::HMODULE kid{ nullptr };      /* PowerOfThree KID handle. */
 
 	/**
-	 * \brief Returns the EditorID for a given FromID.
+	 * \brief Returns the EditorID for a given FromID. Uses the EditorID index, falls back to po3's Tweaks for Forms outside of it.
 	 * \param fromId            - FromID for which EditorID will be returned.
 	 * \return                  - EditorID for given FormID.
 	 */
 	inline std::string GetEditorId(const RE::FormID fromId)
 	{
+		if(const auto editor_id = editor_ids.Find(fromId); !editor_id.empty())
+			return std::string(editor_id);
+
 		if(static auto function = reinterpret_cast<GetFormEditorId>(GetProcAddress(tweaks, "GetFormEditorID")))
 			return function(fromId);
 
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Types/Types.hpp"
+
+namespace flm
+{
+	/**
+	 * \brief Appends Forms to the FormList in the given order. Every Form goes through BGSListForm::AddForm, so the game keeps its own bookkeeping for saves,
+	 * and capacity of the array of Forms added by scripts is reserved once for the whole batch. Duplicates must be filtered out by the caller, e.g. with FormListIndex.
+	 * \param list                          - FormList where Forms will be added.
+	 * \param forms                         - Forms to add, not on the FormList yet.
+	 */
+	inline void AppendForms(RE::BGSListForm* list, const Forms& forms)
+	{
+		if(forms.empty())
+			return;
+
+		// The array for forms added by scripts is created by the game on first use, so it can be reserved only when it exists.
+		if(const auto script_added = list->scriptAddedTempForms)
+			script_added->reserve(script_added->size() + static_cast<std::uint32_t>(forms.size()));
+
+		for(const auto form : forms)
+			list->AddForm(form);
+	}
+
+	/**
+	 * \brief Returns the amount of Forms in the FormList, both from plugins and added by scripts.
+	 * \param list                          - FormList to count.
+	 * \return                              - Amount of Forms.
+	 */
+	inline std::uint32_t FormListSize(const RE::BGSListForm* list)
+	{
+		const auto script_added = list->scriptAddedTempForms;
+		return list->forms.size() + (script_added ? script_added->size() : 0);
+	}
+
+	/**
+	 * \brief Removes Forms from the FormList in one stable compaction pass over forms from plugins and forms added by scripts.
+	 * \param list                          - FormList where Forms will be removed.
+	 * \param formIds                       - FormIDs of Forms to remove.
+	 * \return                              - Amount of removed Forms.
+	 */
+	inline int RemoveForms(RE::BGSListForm* list, const Set<RE::FormID>& formIds)
+	{
+		if(formIds.empty())
+			return 0;
+
+		int removed = 0;
+		auto& forms = list->forms;
+		if(const auto it = std::remove_if(forms.begin(), forms.end(), [&formIds](const RE::TESForm* form)
+										  { return form && formIds.contains(form->GetFormID()); });
+		   it != forms.end())
+		{
+			removed += static_cast<int>(std::distance(it, forms.end()));
+			forms.resize(static_cast<std::uint32_t>(std::distance(forms.begin(), it)));
+		}
+
+		if(const auto script_added = list->scriptAddedTempForms)
+			if(const auto it = std::remove_if(script_added->begin(), script_added->end(), [&formIds](const RE::FormID formId)
+											  { return formIds.contains(formId); });
+			   it != script_added->end())
+			{
+				removed += static_cast<int>(std::distance(it, script_added->end()));
+				script_added->resize(static_cast<std::uint32_t>(std::distance(script_added->begin(), it)));
+			}
+
+		return removed;
+	}
+
+	/**
+	 * \brief Forms of a FormList, collected once so duplicates are found with a hash lookup instead of BGSListForm::HasForm, which scans the list.
+	 * Like HasForm, it covers both the forms from plugins and the forms added by scripts.
+	 * Accepted Forms are collected and appended to the FormList in one batch, in the order they were accepted.
+	 */
+	class FormListIndex
+	{
+		public:
+			/**
+			 * \brief Collects current Forms of the FormList.
+			 * \param list                  - FormList to index.
+			 */
+			explicit FormListIndex(RE::BGSListForm* list);
+
+			/**
+			 * \brief Checks whether the Form is in the FormList or waits to be appended.
+			 * \param form                  - Form to check.
+			 * \return                      - True, if the Form is in the FormList.
+			 */
+			[[nodiscard]] bool Contains(const RE::TESForm* form) const;
+			[[nodiscard]] bool Contains(RE::FormID formId) const;
+
+			/**
+			 * \brief Accepts the Form for the FormList, unless it is already there. The Form is appended by Apply.
+			 * \param form                  - Form to add.
+			 * \return                      - True, if the Form was accepted, false if it is a duplicate.
+			 */
+			bool Add(RE::TESForm* form);
+
+			/**
+			 * \brief Returns accepted Forms, in the order they were accepted, which are not appended yet.
+			 * \return                      - Accepted Forms.
+			 */
+			[[nodiscard]] const Forms& Pending() const;
+
+			/**
+			 * \brief Appends all accepted Forms to the FormList. Capacity is reserved once for the whole batch.
+			 */
+			void Apply();
+
+		private:
+			RE::BGSListForm* list_;    /* Indexed FormList. */
+			Set<RE::FormID> form_ids_; /* FormIDs of all Forms in the FormList. */
+			Forms pending_;            /* Accepted Forms, not appended yet. */
+	};
+
+	inline FormListIndex::FormListIndex(RE::BGSListForm* list) :
+		list_(list)
+	{
+		const auto script_added = list->scriptAddedTempForms;
+		form_ids_.reserve(list->forms.size() + (script_added ? script_added->size() : 0));
+
+		for(const auto form : list->forms)
+			if(form)
+				form_ids_.insert(form->GetFormID());
+
+		if(script_added)
+			for(const auto form_id : *script_added)
+				form_ids_.insert(form_id);
+	}
+
+	inline bool FormListIndex::Contains(const RE::TESForm* form) const
+	{
+		return Contains(form->GetFormID());
+	}
+
+	inline bool FormListIndex::Contains(const RE::FormID formId) const
+	{
+		return form_ids_.contains(formId);
+	}
+
+	inline bool FormListIndex::Add(RE::TESForm* form)
+	{
+		if(!form_ids_.insert(form->GetFormID()).second)
+			return false;
+
+		pending_.push_back(form);
+		return true;
+	}
+
+	inline const Forms& FormListIndex::Pending() const
+	{
+		return pending_;
+	}
+
+	inline void FormListIndex::Apply()
+	{
+		AppendForms(list_, pending_);
+		pending_.clear();
+	}
+}
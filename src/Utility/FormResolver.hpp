@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Utility/Utility.hpp"
+
+namespace flm
+{
+	/**
+	 * \brief Resolves Form references from configs and remembers the results, including missing Forms.
+	 * The same reference used many times (shared seeds, common keywords) is looked up only once.
+	 * References are cached as written, because the lookup itself does not treat every spelling alike (e.g. "0x" and "0X").
+	 */
+	class FormResolver
+	{
+		public:
+			/**
+			 * \brief Creates resolver that counts cache hits and misses.
+			 * \param infos                 - Statistics, where hits and misses will be counted.
+			 */
+			explicit FormResolver(std::array<int, ift::ALL>& infos);
+
+			/**
+			 * \brief Returns a pointer to Form based on reference.
+			 * \tparam T                    - Type of the Form.
+			 * \param reference             - Reference in the format RecordID~ModName or EditorID.
+			 * \return                      - Form pointer or nullptr if not found or has other type.
+			 */
+			template<class T = RE::TESForm>
+			T* Resolve(std::string_view reference);
+
+			/**
+			 * \brief Resolves references one by one through the cache, so every unique reference is looked up at most once.
+			 * \tparam T                    - Type of the Forms.
+			 * \param references            - References to resolve.
+			 * \param forms                 - Vector, where Forms will be added in order of references, nullptr for missing ones.
+			 */
+			template<class T = RE::TESForm>
+			void Resolve(References references, std::vector<T*>& forms);
+
+			/**
+			 * \brief Forgets all resolved references.
+			 */
+			void Clear();
+
+		private:
+			std::array<int, ift::ALL>& infos_; /* Statistics for hits and misses. */
+			StringMap<RE::TESForm*> forms_;    /* Reference - Form, nullptr if missing. */
+	};
+
+	inline FormResolver::FormResolver(std::array<int, ift::ALL>& infos) :
+		infos_(infos) {}
+
+	template<class T>
+	inline T* FormResolver::Resolve(const std::string_view reference)
+	{
+		RE::TESForm* form;
+		if(const auto it = forms_.find(reference); it != forms_.end())
+		{
+			infos_[ift::RESOLVE_HIT]++;
+			form = it->second;
+		}
+		else
+		{
+			infos_[ift::RESOLVE_MISS]++;
+			form = FindForm(reference);
+			forms_.emplace(std::string(reference), form);
+		}
+
+		return form ? form->As<T>() : nullptr;
+	}
+
+	template<class T>
+	inline void FormResolver::Resolve(const References references, std::vector<T*>& forms)
+	{
+		forms.reserve(forms.size() + references.size());
+		for(const auto reference : references)
+			forms.push_back(Resolve<T>(reference));
+	}
+
+	inline void FormResolver::Clear()
+	{
+		forms_.clear();
+	}
+}
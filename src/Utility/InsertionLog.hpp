@@ -0,0 +1,575 @@
+#pragma once
+
+#include "Utility/FormListIndex.hpp"
+#include "Utility/LogInfo.hpp"
+
+namespace flm
+{
+	/**
+	 * \brief Forms inserted by FLM into FormLists, in order of insertion.
+	 * A save restores only Forms added by scripts, so on reload only the recorded Forms are checked and only the ones the save dropped are added again.
+	 * Records are stored in the SKSE cosave as arrays of FormIDs, one block per FormList.
+	 */
+	class InsertionLog
+	{
+		public:
+			static constexpr std::uint32_t record = 'FLMI'; /* Type of the cosave record. */
+			static constexpr std::uint32_t version = 1;     /* Version of the cosave record, must change when the format changes. */
+
+			/**
+			 * \brief Records the Form inserted into the FormList.
+			 * \param list                  - FormList where the Form was inserted.
+			 * \param form                  - Inserted Form.
+			 * \param info                  - Statistic that counts added Forms of this kind.
+			 */
+			void Record(RE::BGSListForm* list, const RE::TESForm* form, InfoT info);
+
+			/**
+			 * \brief Records the pair of Forms inserted into two parallel FormLists.
+			 * \param lists                 - FormLists where the Forms were inserted.
+			 * \param forms                 - Inserted Forms.
+			 * \param info                  - Statistic that counts added pairs of this kind.
+			 */
+			void RecordPair(std::pair<RE::BGSListForm*, RE::BGSListForm*> lists, const FormPair& forms, InfoT info);
+
+			/**
+			 * \brief Forgets Forms removed from the FormList, so they are not added again after a new game or load.
+			 * \param list                  - FormList where the Forms were removed.
+			 * \param formIds               - FormIDs of removed Forms.
+			 */
+			void Forget(const RE::BGSListForm* list, const Set<RE::FormID>& formIds);
+
+			/**
+			 * \brief Records all Forms and pairs recorded by the other log.
+			 * \param other                 - Log to append.
+			 */
+			void Append(const InsertionLog& other);
+
+			/**
+			 * \brief Removes recorded Forms from their FormLists, in one compaction per FormList, and forgets them in the logs.
+			 * Only single Forms are removed, pairs are left in parallel FormLists so they stay aligned.
+			 * \param logs                  - Logs where removed Forms are forgotten.
+			 * \return                      - Amount of removed Forms.
+			 */
+			int Undo(std::initializer_list<InsertionLog*> logs) const;
+
+			/**
+			 * \brief Adds again recorded Forms that are no longer on their FormLists.
+			 * \param infos                 - Statistics, restored Forms are counted as added Forms of their kind.
+			 * \return                      - Amount of checked Forms and pairs.
+			 */
+			int Restore(std::array<int, ift::ALL>& infos) const;
+
+			/**
+			 * \brief Returns the amount of recorded Forms and pairs.
+			 * \return                      - Amount of recorded Forms and pairs.
+			 */
+			[[nodiscard]] int Size() const;
+
+			/**
+			 * \brief Removes all records.
+			 */
+			void Clear();
+
+			/**
+			 * \brief Returns the union of the logs. Blocks are merged by FormList and statistic, Forms recorded by more logs are kept once.
+			 * \param logs                  - Logs to merge.
+			 * \return                      - Merged log.
+			 */
+			static InsertionLog Merge(std::initializer_list<const InsertionLog*> logs);
+
+			/**
+			 * \brief Writes records of all logs to the cosave as one record. Forms recorded by more logs are written once.
+			 * \param serialization         - SKSE serialization interface.
+			 * \param logs                  - Logs to write.
+			 */
+			static void Save(const SKSE::SerializationInterface* serialization, std::initializer_list<const InsertionLog*> logs);
+
+			/**
+			 * \brief Replaces records with the cosave record. FormIDs are remapped to the current load order, Forms from removed plugins are dropped.
+			 * \param serialization         - SKSE serialization interface, positioned at the data of the record.
+			 * \param recordVersion         - Version of the record.
+			 * \param recordLength          - Length of the record in bytes.
+			 * \return                      - True, if the record was read.
+			 */
+			bool Load(const SKSE::SerializationInterface* serialization, std::uint32_t recordVersion, std::uint32_t recordLength);
+
+			/**
+			 * \brief Writes records as blocks of FormIDs into the open cosave record.
+			 * \param serialization         - SKSE serialization interface.
+			 * \return                      - True, if everything was written.
+			 */
+			bool Write(const SKSE::SerializationInterface* serialization) const;
+
+			/**
+			 * \brief Replaces records with blocks of FormIDs read from the cosave record. FormIDs are remapped to the current load order, Forms from removed plugins are dropped.
+			 * \param serialization         - SKSE serialization interface.
+			 * \param remaining             - Bytes left in the record, decreased by the bytes read. Blocks longer than the rest of the record are not read.
+			 * \return                      - True, if all blocks were read.
+			 */
+			bool Read(const SKSE::SerializationInterface* serialization, std::uint32_t& remaining);
+
+		private:
+			struct Singles
+			{
+				RE::BGSListForm* list; /* FormList where the Forms were inserted. */
+				InfoT info;            /* Statistic that counts added Forms. */
+				FormIds form_ids;      /* Inserted Forms. */
+			};
+
+			struct Pairs
+			{
+				RE::BGSListForm* first;  /* FormList where the first Forms were inserted. */
+				RE::BGSListForm* second; /* FormList where the second Forms were inserted. */
+				InfoT info;              /* Statistic that counts added pairs. */
+				FormIds first_ids;       /* Inserted first Forms. */
+				FormIds second_ids;      /* Inserted second Forms, parallel to first_ids. */
+			};
+
+			/**
+			 * \brief Header of a block of Forms inserted into one FormList. Followed by FormIDs.
+			 */
+			struct SinglesHeader
+			{
+				RE::FormID list;     /* FormList where the Forms were inserted. */
+				std::uint32_t info;  /* Statistic that counts added Forms. */
+				std::uint32_t count; /* Amount of FormIDs. */
+			};
+
+			/**
+			 * \brief Header of a block of pairs inserted into two FormLists. Followed by first FormIDs and second FormIDs.
+			 */
+			struct PairsHeader
+			{
+				RE::FormID first;    /* FormList where the first Forms were inserted. */
+				RE::FormID second;   /* FormList where the second Forms were inserted. */
+				std::uint32_t info;  /* Statistic that counts added pairs. */
+				std::uint32_t count; /* Amount of pairs. */
+			};
+
+			std::vector<Singles> singles_; /* Forms inserted into single FormLists. */
+			std::vector<Pairs> pairs_;     /* Pairs of Forms inserted into parallel FormLists. */
+			int size_ = 0;                 /* Amount of recorded Forms and pairs. */
+
+			/**
+			 * \brief Returns FormIDs of Forms added to the FormList by scripts, which are the only ones a save can change.
+			 * \param list                  - FormList to read.
+			 * \return                      - FormIDs of Forms added by scripts.
+			 */
+			static Set<RE::FormID> scriptAdded(const RE::BGSListForm* list);
+
+			/**
+			 * \brief Checks whether the recorded Form is missing from the FormList.
+			 * \param list                  - FormList to check.
+			 * \param scriptAdded           - FormIDs of Forms added to the FormList by scripts.
+			 * \param formId                - FormID of the recorded Form.
+			 * \return                      - Form, if it exists and is missing from the FormList, nullptr otherwise.
+			 */
+			static RE::TESForm* missing(const RE::BGSListForm* list, const Set<RE::FormID>& scriptAdded, RE::FormID formId);
+
+			/**
+			 * \brief Reads a value from the cosave record if it fits in the rest of the record.
+			 * \param serialization         - SKSE serialization interface.
+			 * \param value                 - Value to read.
+			 * \param remaining             - Bytes left in the record, decreased by the size of the value.
+			 * \return                      - True, if the value was read.
+			 */
+			template<class T>
+			static bool readValue(const SKSE::SerializationInterface* serialization, T& value, std::uint32_t& remaining);
+
+			/**
+			 * \brief Checks whether the block of FormIDs fits in the rest of the record, before memory for it is allocated.
+			 * \param count                 - Amount of FormIDs in the block.
+			 * \param remaining             - Bytes left in the record.
+			 * \return                      - True, if the block fits.
+			 */
+			static bool fits(std::uint64_t count, std::uint32_t remaining);
+
+			/**
+			 * \brief Reads FormIDs from the cosave and remaps them to the current load order.
+			 * \param serialization         - SKSE serialization interface.
+			 * \param formIds               - Vector with the size of the block, FormIDs are read into it.
+			 * \param resolved              - Set to false for every FormID that could not be remapped, may be nullptr.
+			 * \param remaining             - Bytes left in the record, decreased by the size of the block.
+			 * \return                      - True, if the whole block was read.
+			 */
+			static bool readFormIds(const SKSE::SerializationInterface* serialization, FormIds& formIds, std::vector<bool>* resolved, std::uint32_t& remaining);
+
+			/**
+			 * \brief Returns the FormList with the FormID from the cosave, remapped to the current load order.
+			 * \param serialization         - SKSE serialization interface.
+			 * \param formId                - FormID from the cosave.
+			 * \return                      - FormList or nullptr if it no longer exists.
+			 */
+			static RE::BGSListForm* resolveList(const SKSE::SerializationInterface* serialization, RE::FormID formId);
+	};
+
+	inline void InsertionLog::Record(RE::BGSListForm* list, const RE::TESForm* form, const InfoT info)
+	{
+		if(singles_.empty() || singles_.back().list != list || singles_.back().info != info)
+			singles_.push_back({ list, info, {} });
+
+		singles_.back().form_ids.push_back(form->GetFormID());
+		size_++;
+	}
+
+	inline void InsertionLog::RecordPair(const std::pair<RE::BGSListForm*, RE::BGSListForm*> lists, const FormPair& forms, const InfoT info)
+	{
+		if(pairs_.empty() || pairs_.back().first != lists.first || pairs_.back().second != lists.second || pairs_.back().info != info)
+			pairs_.push_back({ lists.first, lists.second, info, {}, {} });
+
+		pairs_.back().first_ids.push_back(forms.first->GetFormID());
+		pairs_.back().second_ids.push_back(forms.second->GetFormID());
+		size_++;
+	}
+
+	inline void InsertionLog::Forget(const RE::BGSListForm* list, const Set<RE::FormID>& formIds)
+	{
+		for(auto& [block_list, info, form_ids] : singles_)
+			if(block_list == list)
+				size_ -= static_cast<int>(std::erase_if(form_ids, [&formIds](const RE::FormID formId)
+														 { return formIds.contains(formId); }));
+
+		std::erase_if(singles_, [](const Singles& singles)
+					  { return singles.form_ids.empty(); });
+	}
+
+	inline void InsertionLog::Append(const InsertionLog& other)
+	{
+		singles_.insert(singles_.end(), other.singles_.begin(), other.singles_.end());
+		pairs_.insert(pairs_.end(), other.pairs_.begin(), other.pairs_.end());
+		size_ += other.size_;
+	}
+
+	inline int InsertionLog::Undo(const std::initializer_list<InsertionLog*> logs) const
+	{
+		int removed = 0;
+		for(const auto& [list, info, form_ids] : singles_)
+		{
+			const Set<RE::FormID> remove(form_ids.begin(), form_ids.end());
+			removed += RemoveForms(list, remove);
+			for(const auto log : logs)
+				log->Forget(list, remove);
+		}
+		return removed;
+	}
+
+	inline int InsertionLog::Restore(std::array<int, ift::ALL>& infos) const
+	{
+		Forms restored;
+		for(const auto& [list, info, form_ids] : singles_)
+		{
+			const auto script_added = scriptAdded(list);
+			for(const auto form_id : form_ids)
+				if(const auto form = missing(list, script_added, form_id))
+					restored.push_back(form);
+
+			infos[info] += static_cast<int>(restored.size());
+			AppendForms(list, restored);
+			restored.clear();
+		}
+
+		Forms restored_second;
+		for(const auto& [first, second, info, first_ids, second_ids] : pairs_)
+		{
+			const auto first_added = scriptAdded(first);
+			const auto second_added = scriptAdded(second);
+			for(std::size_t i = 0; i < first_ids.size(); i++)
+			{
+				// As on the first insertion, a pair is added only when both Forms are missing, so both FormLists stay parallel.
+				const auto first_form = missing(first, first_added, first_ids[i]);
+				const auto second_form = first_form ? missing(second, second_added, second_ids[i]) : nullptr;
+				if(!second_form)
+					continue;
+
+				restored.push_back(first_form);
+				restored_second.push_back(second_form);
+			}
+
+			infos[info] += static_cast<int>(restored.size());
+			AppendForms(first, restored);
+			AppendForms(second, restored_second);
+			restored.clear();
+			restored_second.clear();
+		}
+
+		return size_;
+	}
+
+	inline int InsertionLog::Size() const
+	{
+		return size_;
+	}
+
+	inline void InsertionLog::Clear()
+	{
+		singles_.clear();
+		pairs_.clear();
+		size_ = 0;
+	}
+
+	inline InsertionLog InsertionLog::Merge(const std::initializer_list<const InsertionLog*> logs)
+	{
+		// Blocks of all logs are merged by FormList and statistic, in order they were first recorded.
+		std::vector<Singles> singles;
+		std::vector<Set<RE::FormID>> singles_seen;
+		std::map<std::pair<RE::FormID, InfoT>, std::size_t> singles_blocks;
+		std::vector<Pairs> pairs;
+		std::vector<Set<std::uint64_t>> pairs_seen;
+		std::map<std::tuple<RE::FormID, RE::FormID, InfoT>, std::size_t> pairs_blocks;
+
+		for(const auto log : logs)
+		{
+			for(const auto& [list, info, form_ids] : log->singles_)
+			{
+				const auto [it, created] = singles_blocks.try_emplace({ list->GetFormID(), info }, singles.size());
+				if(created)
+				{
+					singles.push_back({ list, info, {} });
+					singles_seen.emplace_back();
+				}
+
+				auto& block = singles[it->second];
+				for(const auto form_id : form_ids)
+					if(singles_seen[it->second].insert(form_id).second)
+						block.form_ids.push_back(form_id);
+			}
+
+			for(const auto& [first, second, info, first_ids, second_ids] : log->pairs_)
+			{
+				const auto [it, created] = pairs_blocks.try_emplace({ first->GetFormID(), second->GetFormID(), info }, pairs.size());
+				if(created)
+				{
+					pairs.push_back({ first, second, info, {}, {} });
+					pairs_seen.emplace_back();
+				}
+
+				auto& block = pairs[it->second];
+				for(std::size_t i = 0; i < first_ids.size(); i++)
+					if(pairs_seen[it->second].insert(static_cast<std::uint64_t>(first_ids[i]) << 32 | second_ids[i]).second)
+					{
+						block.first_ids.push_back(first_ids[i]);
+						block.second_ids.push_back(second_ids[i]);
+					}
+			}
+		}
+
+		InsertionLog merged;
+		for(const auto& block : singles)
+			merged.size_ += static_cast<int>(block.form_ids.size());
+		for(const auto& block : pairs)
+			merged.size_ += static_cast<int>(block.first_ids.size());
+		merged.singles_ = std::move(singles);
+		merged.pairs_ = std::move(pairs);
+		return merged;
+	}
+
+	inline void InsertionLog::Save(const SKSE::SerializationInterface* serialization, const std::initializer_list<const InsertionLog*> logs)
+	{
+		if(!serialization->OpenRecord(record, version))
+		{
+			log::Error("Unable to open the cosave record for FormLists.");
+			return;
+		}
+
+		if(!Merge(logs).Write(serialization))
+			log::Error("Unable to write FormLists to the cosave.");
+	}
+
+	inline bool InsertionLog::Write(const SKSE::SerializationInterface* serialization) const
+	{
+		const auto write_ids = [serialization](const FormIds& formIds)
+		{
+			return formIds.empty() || serialization->WriteRecordData(formIds.data(), static_cast<std::uint32_t>(formIds.size() * sizeof(RE::FormID)));
+		};
+
+		bool written = serialization->WriteRecordData(static_cast<std::uint32_t>(singles_.size())) &&
+					   serialization->WriteRecordData(static_cast<std::uint32_t>(pairs_.size()));
+
+		for(const auto& [list, info, form_ids] : singles_)
+		{
+			const SinglesHeader header{ list->GetFormID(), static_cast<std::uint32_t>(info), static_cast<std::uint32_t>(form_ids.size()) };
+			written = written && serialization->WriteRecordData(header) && write_ids(form_ids);
+		}
+
+		for(const auto& [first, second, info, first_ids, second_ids] : pairs_)
+		{
+			const PairsHeader header{ first->GetFormID(), second->GetFormID(), static_cast<std::uint32_t>(info), static_cast<std::uint32_t>(first_ids.size()) };
+			written = written && serialization->WriteRecordData(header) && write_ids(first_ids) && write_ids(second_ids);
+		}
+
+		return written;
+	}
+
+	inline bool InsertionLog::Load(const SKSE::SerializationInterface* serialization, const std::uint32_t recordVersion, std::uint32_t recordLength)
+	{
+		if(recordVersion != version)
+		{
+			log::Warn("Unsupported version {} of FormLists in the cosave, skipping.", recordVersion);
+			Clear();
+			return false;
+		}
+
+		return Read(serialization, recordLength);
+	}
+
+	inline bool InsertionLog::Read(const SKSE::SerializationInterface* serialization, std::uint32_t& remaining)
+	{
+		Clear();
+		std::uint32_t singles_count = 0;
+		std::uint32_t pairs_count = 0;
+		if(!readValue(serialization, singles_count, remaining) || !readValue(serialization, pairs_count, remaining))
+			return false;
+
+		std::vector<bool> resolved;
+		for(std::uint32_t i = 0; i < singles_count; i++)
+		{
+			SinglesHeader header{};
+			if(!readValue(serialization, header, remaining))
+			{
+				Clear();
+				return false;
+			}
+
+			// The count comes from the cosave, a corrupted one must not allocate more than the record holds.
+			if(!fits(header.count, remaining))
+			{
+				log::Warn("Block of {} Forms of FormList {:X} is longer than the cosave record, the record is skipped.", header.count, header.list);
+				Clear();
+				return false;
+			}
+
+			FormIds form_ids(header.count);
+			if(!readFormIds(serialization, form_ids, nullptr, remaining))
+			{
+				Clear();
+				return false;
+			}
+
+			const auto list = resolveList(serialization, header.list);
+			if(!list || header.info >= ift::ALL)
+			{
+				log::Warn("FormList {:X} from the cosave no longer exists or has unknown kind, {} Forms skipped.", header.list, header.count);
+				continue;
+			}
+			if(form_ids.empty())
+				continue;
+
+			size_ += static_cast<int>(form_ids.size());
+			singles_.push_back({ list, static_cast<InfoT>(header.info), std::move(form_ids) });
+		}
+
+		for(std::uint32_t i = 0; i < pairs_count; i++)
+		{
+			PairsHeader header{};
+			if(!readValue(serialization, header, remaining))
+			{
+				Clear();
+				return false;
+			}
+
+			if(!fits(std::uint64_t{ header.count } * 2, remaining))
+			{
+				log::Warn("Block of {} pairs of FormLists {:X} and {:X} is longer than the cosave record, the record is skipped.", header.count, header.first, header.second);
+				Clear();
+				return false;
+			}
+
+			FormIds first_ids(header.count);
+			FormIds second_ids(header.count);
+			resolved.assign(header.count, true);
+			if(!readFormIds(serialization, first_ids, &resolved, remaining) || !readFormIds(serialization, second_ids, &resolved, remaining))
+			{
+				Clear();
+				return false;
+			}
+
+			const auto first = resolveList(serialization, header.first);
+			const auto second = resolveList(serialization, header.second);
+			if(!first || !second || header.info >= ift::ALL)
+			{
+				log::Warn("FormLists {:X} and {:X} from the cosave no longer exist or have unknown kind, {} pairs skipped.", header.first, header.second, header.count);
+				continue;
+			}
+
+			// A pair is kept only when both Forms still exist, so both FormLists stay parallel.
+			Pairs pairs{ first, second, static_cast<InfoT>(header.info), {}, {} };
+			for(std::uint32_t j = 0; j < header.count; j++)
+				if(resolved[j])
+				{
+					pairs.first_ids.push_back(first_ids[j]);
+					pairs.second_ids.push_back(second_ids[j]);
+				}
+
+			size_ += static_cast<int>(pairs.first_ids.size());
+			if(!pairs.first_ids.empty())
+				pairs_.push_back(std::move(pairs));
+		}
+
+		return true;
+	}
+
+	template<class T>
+	inline bool InsertionLog::readValue(const SKSE::SerializationInterface* serialization, T& value, std::uint32_t& remaining)
+	{
+		if(remaining < sizeof(T) || !serialization->ReadRecordData(value))
+			return false;
+
+		remaining -= sizeof(T);
+		return true;
+	}
+
+	inline bool InsertionLog::fits(const std::uint64_t count, const std::uint32_t remaining)
+	{
+		return count * sizeof(RE::FormID) <= remaining;
+	}
+
+	inline bool InsertionLog::readFormIds(const SKSE::SerializationInterface* serialization, FormIds& formIds, std::vector<bool>* resolved, std::uint32_t& remaining)
+	{
+		const auto size = static_cast<std::uint32_t>(formIds.size() * sizeof(RE::FormID));
+		if(size > remaining || size != 0 && serialization->ReadRecordData(formIds.data(), size) != size)
+			return false;
+
+		remaining -= size;
+
+		if(resolved)
+		{
+			for(std::size_t i = 0; i < formIds.size(); i++)
+				if(!serialization->ResolveFormID(formIds[i], formIds[i]))
+					(*resolved)[i] = false;
+			return true;
+		}
+
+		std::erase_if(formIds, [serialization](RE::FormID& formId)
+					  { return !serialization->ResolveFormID(formId, formId); });
+		return true;
+	}
+
+	inline RE::BGSListForm* InsertionLog::resolveList(const SKSE::SerializationInterface* serialization, const RE::FormID formId)
+	{
+		RE::FormID resolved = 0;
+		return serialization->ResolveFormID(formId, resolved) ? RE::TESForm::LookupByID<RE::BGSListForm>(resolved) : nullptr;
+	}
+
+	inline Set<RE::FormID> InsertionLog::scriptAdded(const RE::BGSListForm* list)
+	{
+		Set<RE::FormID> form_ids;
+		if(const auto script_added = list->scriptAddedTempForms)
+		{
+			form_ids.reserve(script_added->size());
+			for(const auto form_id : *script_added)
+				form_ids.insert(form_id);
+		}
+		return form_ids;
+	}
+
+	inline RE::TESForm* InsertionLog::missing(const RE::BGSListForm* list, const Set<RE::FormID>& scriptAdded, const RE::FormID formId)
+	{
+		if(scriptAdded.contains(formId))
+			return nullptr;
+
+		// Rare case, the full check is done only for Forms that are not among Forms added by scripts.
+		const auto form = RE::TESForm::LookupByID(formId);
+		return form && !list->HasForm(form) ? form : nullptr;
+	}
+}
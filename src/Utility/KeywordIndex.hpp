@@ -0,0 +1,291 @@
+#pragma once
+
+#include "Types/Types.hpp"
+
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_IX86_FP) && _M_IX86_FP >= 2
+	#define FLM_KEYWORDS_SSE2
+	#include <emmintrin.h>
+#endif
+
+namespace flm
+{
+	/**
+	 * \brief Inverted index of keywords of Forms of one FormType. For every keyword, positions of Forms that have it, in order of the form array.
+	 * Every keyword used by Collections has a bit, and every Form has a signature of such bits, so a Collection is tested with AND/ANDNOT of masks.
+	 */
+	class KeywordIndex
+	{
+		public:
+			using Positions = std::vector<std::uint32_t>; /* Sorted positions of Forms in the index. */
+			using Word = std::uint64_t;                   /* Word of signatures and masks. */
+
+#if defined(__AVX2__)
+			static constexpr std::size_t lane_words = 4; /* Words tested by one AVX2 instruction. */
+#elif defined(FLM_KEYWORDS_SSE2)
+			static constexpr std::size_t lane_words = 2; /* Words tested by one SSE2 instruction. */
+#else
+			static constexpr std::size_t lane_words = 1; /* Words tested by one scalar instruction. */
+#endif
+			static constexpr std::size_t chunk_size = 2048; /* Forms of the form array indexed by one task. */
+
+			/**
+			 * \brief Indexes keywords of all Forms from the form array. Forms without keywords are skipped.
+			 * Chunks of the form array are indexed in parallel and merged in order, so positions are the same as in a sequential scan.
+			 * \tparam T                    - Class of Forms (RE::TESObjectARMO, RE::TESObjectWEAP, etc).
+			 * \param forms                 - Form array from the data handler.
+			 * \param filters               - Keywords of Collections, every keyword gets a bit in signatures.
+			 */
+			template<class T>
+			void Build(const RE::BSTArray<T*>& forms, const std::vector<const KeywordsPairVec*>& filters);
+
+			/**
+			 * \brief Returns Forms that have all keywords from the first vector and none from the second.
+			 * Candidates are Forms with the first required keyword, every candidate is tested with its signature.
+			 * \param filter                - Required and excluded keywords.
+			 * \return                      - Matching Forms, in order of the form array.
+			 */
+			[[nodiscard]] Forms Match(const KeywordsPairVec& filter) const;
+
+			/**
+			 * \brief Orders required keywords of the Collection by selectivity, from the rarest, so candidates are the fewest.
+			 * \param filter                - Required and excluded keywords.
+			 * \return                      - False, if a required keyword never occurs, so the Collection matches nothing.
+			 */
+			bool Order(KeywordsPairVec& filter) const;
+
+			/**
+			 * \brief Returns the amount of indexed Forms that have the keyword.
+			 * \param keyword               - Keyword to count.
+			 * \return                      - Length of the posting list of the keyword.
+			 */
+			[[nodiscard]] std::size_t Occurrences(RE::BGSKeyword* keyword) const;
+
+			/**
+			 * \brief Returns the amount of indexed Forms.
+			 * \return                      - Amount of Forms with keywords.
+			 */
+			[[nodiscard]] std::size_t Size() const;
+
+			/**
+			 * \brief Returns the amount of keywords used by Collections.
+			 * \param missing               - Amount of keywords that no Form has.
+			 * \return                      - Amount of keywords with a bit in signatures.
+			 */
+			[[nodiscard]] std::size_t UsedKeywords(std::size_t& missing) const;
+
+		private:
+			/**
+			 * \brief Part of the index built from one chunk of the form array, positions are local to the chunk.
+			 */
+			struct Chunk
+			{
+				Forms forms;                               /* Forms with keywords, in order of the chunk. */
+				Map<RE::BGSKeyword*, Positions> postings; /* Positions of Forms for every keyword. */
+				std::vector<Word> signatures;             /* Signatures of Forms, words_ words per Form. */
+			};
+
+			Forms forms_;                                 /* Forms with keywords, in order of the form array. */
+			Map<RE::BGSKeyword*, Positions> postings_;   /* Positions of Forms for every keyword. */
+			Map<RE::BGSKeyword*, std::uint32_t> bits_;   /* Bit of every keyword used by Collections. */
+			std::vector<Word> signatures_;               /* Signatures of Forms, words_ words per Form. */
+			std::size_t words_ = lane_words;              /* Words of a signature, multiple of lane_words. */
+
+			/**
+			 * \brief Returns the posting list of the keyword.
+			 * \param keyword               - Keyword to find.
+			 * \return                      - Positions of Forms with the keyword, nullptr if no Form has it.
+			 */
+			[[nodiscard]] const Positions* find(RE::BGSKeyword* keyword) const;
+
+			/**
+			 * \brief Indexes keywords of the Form into the chunk. Forms without keywords are skipped.
+			 * \param form                  - Form to index.
+			 * \param chunk                 - Chunk of the index.
+			 */
+			void index(RE::TESForm* form, Chunk& chunk) const;
+
+			/**
+			 * \brief Sets bits of keywords in the mask.
+			 * \param keywords              - Keywords to set.
+			 * \param mask                  - Mask of words_ words.
+			 * \return                      - False, if a keyword has no bit.
+			 */
+			bool compile(const Keywords& keywords, std::vector<Word>& mask) const;
+
+			/**
+			 * \brief Tests if the signature has all required bits and no excluded bits.
+			 * \param signature             - Signature of the Form.
+			 * \param required              - Mask of required keywords.
+			 * \param excluded              - Mask of excluded keywords.
+			 * \param words                 - Words of the signature and masks, multiple of lane_words.
+			 * \return                      - True, if the Form matches.
+			 */
+			[[nodiscard]] static bool matches(const Word* signature, const Word* required, const Word* excluded, std::size_t words);
+	};
+
+	template<class T>
+	inline void KeywordIndex::Build(const RE::BSTArray<T*>& forms, const std::vector<const KeywordsPairVec*>& filters)
+	{
+		forms_.clear();
+		postings_.clear();
+		bits_.clear();
+		signatures_.clear();
+		forms_.reserve(forms.size());
+
+		for(const auto filter : filters)
+		{
+			for(const auto keyword : filter->first)
+				bits_.try_emplace(keyword, static_cast<std::uint32_t>(bits_.size()));
+			for(const auto keyword : filter->second)
+				bits_.try_emplace(keyword, static_cast<std::uint32_t>(bits_.size()));
+		}
+
+		const std::size_t bit_words = std::max<std::size_t>(1, (bits_.size() + 63) / 64);
+		words_ = (bit_words + lane_words - 1) / lane_words * lane_words;
+
+		std::vector<Chunk> chunks((forms.size() + chunk_size - 1) / chunk_size);
+		std::for_each(std::execution::par, chunks.begin(), chunks.end(), [&](Chunk& chunk)
+		{
+			const std::size_t first = static_cast<std::size_t>(&chunk - chunks.data()) * chunk_size;
+			const std::size_t last = std::min<std::size_t>(first + chunk_size, forms.size());
+			for(std::size_t i = first; i < last; i++)
+				index(forms[static_cast<std::uint32_t>(i)], chunk);
+		});
+
+		for(auto& chunk : chunks)
+		{
+			const auto offset = static_cast<std::uint32_t>(forms_.size());
+			forms_.insert(forms_.end(), chunk.forms.begin(), chunk.forms.end());
+			signatures_.insert(signatures_.end(), chunk.signatures.begin(), chunk.signatures.end());
+			for(const auto& [keyword, positions] : chunk.postings)
+			{
+				auto& merged = postings_[keyword];
+				for(const auto position : positions)
+					merged.push_back(offset + position);
+			}
+		}
+	}
+
+	inline Forms KeywordIndex::Match(const KeywordsPairVec& filter) const
+	{
+		std::vector<Word> required(words_);
+		std::vector<Word> excluded(words_);
+		// Build gives every keyword of Collections a bit, so only a Collection that was not passed to Build fails here.
+		if(!compile(filter.first, required) || !compile(filter.second, excluded))
+			return {};
+
+		Forms forms;
+		if(filter.first.empty())
+		{
+			for(std::size_t position = 0; position < forms_.size(); position++)
+				if(matches(&signatures_[position * words_], required.data(), excluded.data(), words_))
+					forms.push_back(forms_[position]);
+			return forms;
+		}
+
+		const auto candidates = find(filter.first.front());
+		if(!candidates)
+			return {};
+
+		for(const auto position : *candidates)
+			if(matches(&signatures_[position * words_], required.data(), excluded.data(), words_))
+				forms.push_back(forms_[position]);
+		return forms;
+	}
+
+	inline bool KeywordIndex::Order(KeywordsPairVec& filter) const
+	{
+		std::ranges::stable_sort(filter.first, std::less{}, [this](RE::BGSKeyword* keyword) { return Occurrences(keyword); });
+		return filter.first.empty() || Occurrences(filter.first.front()) != 0;
+	}
+
+	inline std::size_t KeywordIndex::Occurrences(RE::BGSKeyword* keyword) const
+	{
+		const auto positions = find(keyword);
+		return positions ? positions->size() : 0;
+	}
+
+	inline std::size_t KeywordIndex::Size() const
+	{
+		return forms_.size();
+	}
+
+	inline std::size_t KeywordIndex::UsedKeywords(std::size_t& missing) const
+	{
+		missing = std::ranges::count_if(bits_, [this](const auto& bit) { return !postings_.contains(bit.first); });
+		return bits_.size();
+	}
+
+	inline const KeywordIndex::Positions* KeywordIndex::find(RE::BGSKeyword* keyword) const
+	{
+		const auto it = postings_.find(keyword);
+		return it != postings_.end() ? &it->second : nullptr;
+	}
+
+	inline void KeywordIndex::index(RE::TESForm* form, Chunk& chunk) const
+	{
+		if(!form)
+			return;
+
+		const auto keyword_form = form->As<RE::BGSKeywordForm>();
+		if(!keyword_form || keyword_form->numKeywords == 0)
+			return;
+
+		const auto position = static_cast<std::uint32_t>(chunk.forms.size());
+		chunk.forms.push_back(form);
+		chunk.signatures.resize(chunk.signatures.size() + words_);
+		const auto signature = chunk.signatures.end() - static_cast<std::ptrdiff_t>(words_);
+		for(std::uint32_t i = 0; i < keyword_form->numKeywords; i++)
+		{
+			const auto keyword = keyword_form->keywords[i];
+
+			// A keyword repeated on the Form is indexed once, so posting lists stay sorted and unique.
+			auto& positions = chunk.postings[keyword];
+			if(positions.empty() || positions.back() != position)
+				positions.push_back(position);
+
+			if(const auto bit = bits_.find(keyword); bit != bits_.end())
+				signature[bit->second / 64] |= Word{ 1 } << (bit->second % 64);
+		}
+	}
+
+	inline bool KeywordIndex::compile(const Keywords& keywords, std::vector<Word>& mask) const
+	{
+		for(const auto keyword : keywords)
+		{
+			const auto bit = bits_.find(keyword);
+			if(bit == bits_.end())
+				return false;
+			mask[bit->second / 64] |= Word{ 1 } << (bit->second % 64);
+		}
+
+		return true;
+	}
+
+	inline bool KeywordIndex::matches(const Word* signature, const Word* required, const Word* excluded, const std::size_t words)
+	{
+		for(std::size_t i = 0; i < words; i += lane_words)
+		{
+#if defined(__AVX2__)
+			const auto s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(signature + i));
+			const auto missing = _mm256_andnot_si256(s, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(required + i)));
+			const auto present = _mm256_and_si256(s, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(excluded + i)));
+			if(!_mm256_testz_si256(_mm256_or_si256(missing, present), _mm256_set1_epi8(-1)))
+				return false;
+#elif defined(FLM_KEYWORDS_SSE2)
+			const auto s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(signature + i));
+			const auto missing = _mm_andnot_si128(s, _mm_loadu_si128(reinterpret_cast<const __m128i*>(required + i)));
+			const auto present = _mm_and_si128(s, _mm_loadu_si128(reinterpret_cast<const __m128i*>(excluded + i)));
+			if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(missing, present), _mm_setzero_si128())) != 0xFFFF)
+				return false;
+#else
+			if((required[i] & ~signature[i]) != 0 || (signature[i] & excluded[i]) != 0)
+				return false;
+#endif
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,350 @@
+#pragma once
+
+#include "Utility/Types/ConfigEntry.hpp"
+
+namespace flm
+{
+	/**
+	 * \brief Returns the type of entry for a key from config file. The key is hashed once and compared only with the keyword in its slot.
+	 * \param key           - Key to check. Not case-sensitive.
+	 * \return              - Type of the entry, ALL if the key is unknown.
+	 */
+	constexpr EntryType::EntryType ClassifyKey(const std::string_view key)
+	{
+		const auto type = key_table.types[HashKey(key, key_table.seed) & (KeyTable::size - 1)];
+		if(type == EntryType::ALL)
+			return EntryType::ALL;
+
+		return std::ranges::equal(keywords[type], key, [](const char a, const char b)
+								  { return a == (b >= 'A' && b <= 'Z' ? b + ('a' - 'A') : b); }) ?
+				   type :
+				   EntryType::ALL;
+	}
+
+	static_assert(ClassifyKey("FormList"sv) == EntryType::FLIST && ClassifyKey("dragonbornSpiderCrafting"sv) == EntryType::DSCRF && ClassifyKey("forms"sv) == EntryType::ALL);
+
+	/**
+	 * \brief Tokenizes entries of a config file in a single pass, without regular expressions.
+	 * Strips spaces around | and , separators, strips leading zeros from FormIDs and swaps Dawnguard and Dragonborn FormIDs
+	 * (VR apparently does not load masters in order so the lookup fails). Idea from https://github.com/powerof3/Spell-Perk-Item-Distributor.
+	 * Sanitized keys and values are stored in one buffer of the config file, sections and references are views into it.
+	 */
+	class Lexer
+	{
+		public:
+			/**
+			 * \brief Prepares the lexer for a config file.
+			 * \param config                - Config file that will own the tokens.
+			 * \param capacity              - Expected total length of all keys and values.
+			 */
+			Lexer(ConfigFile& config, std::size_t capacity);
+
+			/**
+			 * \brief Tokenizes the entry and adds it to the config file.
+			 * \param key                   - Key as written in the config file.
+			 * \param value                 - Raw value.
+			 * \param line                  - Position of the entry in the config file.
+			 */
+			void Tokenize(std::string_view key, std::string_view value, int line);
+
+			/**
+			 * \brief Binds views of all tokenized entries to the buffer. Must be called once, after the last entry.
+			 */
+			void Finish();
+
+		private:
+			/**
+			 * \brief Location of a token in the buffer, with location of its child tokens.
+			 */
+			struct Range
+			{
+				std::size_t offset = 0; /* Offset of the token in the buffer. */
+				std::size_t size = 0;   /* Length of the token. */
+				std::size_t first = 0;  /* Index of the first child token. */
+				std::size_t count = 0;  /* Amount of child tokens. */
+			};
+
+			ConfigFile& config_;            /* Config file that owns the tokens. */
+			std::string form_id_;           /* Scratch for references with FormIDs. */
+			std::vector<Range> keys_;       /* Keys of the entries. */
+			std::vector<Range> values_;     /* Values of the entries, children are sections. */
+			std::vector<Range> sections_;   /* Sections, children are references. */
+			std::vector<Range> references_; /* References. */
+
+			/**
+			 * \brief Appends text to the buffer.
+			 * \param text                  - Text to append.
+			 */
+			void append(std::string_view text);
+
+			/**
+			 * \brief Adds reference that starts at the offset and ends at the end of the buffer.
+			 * \param offset                - Offset of the reference in the buffer.
+			 * \param formId                - True, if the reference may contain a FormID to swap.
+			 */
+			void addReference(std::size_t offset, bool formId);
+
+			/**
+			 * \brief Adds section that starts at the offset and ends at the end of the buffer.
+			 * \param offset                - Offset of the section in the buffer.
+			 */
+			void addSection(std::size_t offset);
+
+			/**
+			 * \brief Swaps Dawnguard and Dragonborn FormIDs in the reference at the end of the buffer.
+			 * \param offset                - Offset of the reference in the buffer.
+			 */
+			void swapFormIds(std::size_t offset);
+
+			/**
+			 * \brief Checks whether the character is a white space.
+			 * \param c                     - Character to check.
+			 * \return                      - True, if the character is a white space.
+			 */
+			static bool isSpace(char c);
+
+			/**
+			 * \brief Checks whether the character is a hexadecimal digit.
+			 * \param c                     - Character to check.
+			 * \return                      - True, if the character is a hexadecimal digit.
+			 */
+			static bool isHex(char c);
+
+			/**
+			 * \brief Returns the length of the hexadecimal digits at the position.
+			 * \param text                  - Text to check.
+			 * \param position              - Position of the first digit.
+			 * \return                      - Amount of hexadecimal digits.
+			 */
+			static std::size_t hexLength(std::string_view text, std::size_t position);
+
+			/**
+			 * \brief Checks whether there is a FormID of the master at the position, e.g 0x02XXXXXX.
+			 * \param text                  - Text to check.
+			 * \param position              - Position of the FormID.
+			 * \param index                 - Load order index of the master.
+			 * \return                      - Length of the FormID, 0 if there is no FormID of the master.
+			 */
+			static std::size_t masterFormIdLength(std::string_view text, std::size_t position, char index);
+	};
+
+	inline Lexer::Lexer(ConfigFile& config, const std::size_t capacity) :
+		config_(config)
+	{
+		config_.buffer.reserve(capacity);
+	}
+
+	inline void Lexer::Tokenize(const std::string_view key, const std::string_view value, const int line)
+	{
+		auto& entry = config_.entries.emplace_back();
+		entry.type = ClassifyKey(key);
+		entry.line = line;
+
+		keys_.push_back({ config_.buffer.size(), key.size() });
+		append(key);
+
+		Range value_range{ config_.buffer.size(), 0, sections_.size(), 0 };
+		std::size_t section = config_.buffer.size();
+		std::size_t reference = config_.buffer.size();
+		bool form_id = false;
+
+		for(std::size_t i = 0; i < value.size();)
+		{
+			const char c = value[i];
+			if(isSpace(c))
+			{
+				// Strip spaces between " | " and " , ".
+				std::size_t end = i;
+				while(end < value.size() && isSpace(value[end]))
+					end++;
+				const bool separator = (i > 0 && (value[i - 1] == '|' || value[i - 1] == ',')) || (end < value.size() && (value[end] == '|' || value[end] == ','));
+				if(!separator)
+					append(value.substr(i, end - i));
+				i = end;
+			}
+			else if(c == '|' || c == ',')
+			{
+				addReference(reference, form_id);
+				if(c == '|')
+				{
+					addSection(section);
+					section = config_.buffer.size() + 1;
+				}
+				config_.buffer.push_back(c);
+				reference = config_.buffer.size();
+				form_id = false;
+				i++;
+			}
+			else if(c == '0' && i + 1 < value.size() && (value[i + 1] == 'x' || value[i + 1] == 'X'))
+			{
+				form_id = true;
+				// Strip leading zeros, only after lowercase 0x.
+				if(value[i + 1] == 'x')
+				{
+					std::size_t zeros = 0;
+					while(i + 2 + zeros < value.size() && value[i + 2 + zeros] == '0')
+						zeros++;
+					if(const auto digits = hexLength(value, i + 2); zeros >= 2 && digits > zeros)
+					{
+						append("0x"sv);
+						append(value.substr(i + 2 + zeros, digits - zeros));
+						i += 2 + digits;
+						continue;
+					}
+					else if(zeros >= 3)
+					{
+						append("0x0"sv);
+						i += 2 + digits;
+						continue;
+					}
+				}
+				config_.buffer.push_back(c);
+				i++;
+			}
+			else
+			{
+				config_.buffer.push_back(c);
+				i++;
+			}
+		}
+
+		if(config_.buffer.size() != value_range.offset)
+		{
+			addReference(reference, form_id);
+			addSection(section);
+			value_range.count = sections_.size() - value_range.first;
+		}
+		value_range.size = config_.buffer.size() - value_range.offset;
+
+		// Filters are not case-sensitive.
+		if(entry.type == EntryType::FILTR)
+			std::ranges::transform(config_.buffer.begin() + static_cast<std::ptrdiff_t>(value_range.offset), config_.buffer.end(), config_.buffer.begin() + static_cast<std::ptrdiff_t>(value_range.offset), [](const unsigned char ch)
+								   { return static_cast<char>(std::tolower(ch)); });
+
+		values_.push_back(value_range);
+	}
+
+	inline void Lexer::Finish()
+	{
+		const std::string_view buffer(config_.buffer.data(), config_.buffer.size());
+
+		config_.references.reserve(references_.size());
+		for(const auto& r : references_)
+			config_.references.emplace_back(buffer.substr(r.offset, r.size));
+
+		config_.sections.reserve(sections_.size());
+		for(const auto& s : sections_)
+			config_.sections.push_back({ buffer.substr(s.offset, s.size), References(config_.references.data() + s.first, s.count) });
+
+		for(std::size_t i = 0; i < config_.entries.size(); i++)
+		{
+			auto& entry = config_.entries[i];
+			entry.key = buffer.substr(keys_[i].offset, keys_[i].size);
+			entry.value = buffer.substr(values_[i].offset, values_[i].size);
+			entry.sections = Sections(config_.sections.data() + values_[i].first, values_[i].count);
+		}
+	}
+
+	inline void Lexer::append(const std::string_view text)
+	{
+		config_.buffer.insert(config_.buffer.end(), text.begin(), text.end());
+	}
+
+	inline void Lexer::addReference(const std::size_t offset, const bool formId)
+	{
+		if(formId)
+			swapFormIds(offset);
+		references_.push_back({ offset, config_.buffer.size() - offset });
+	}
+
+	inline void Lexer::addSection(const std::size_t offset)
+	{
+		Range section{ offset, config_.buffer.size() - offset, 0, 0 };
+
+		// References of the section are the last ones added, empty section has no references and points at the end of them.
+		std::size_t first = references_.size();
+		while(first > 0 && references_[first - 1].offset >= offset)
+			first--;
+		if(section.size == 0)
+			references_.resize(first);
+		section.first = first;
+		section.count = references_.size() - first;
+
+		sections_.push_back(section);
+	}
+
+	inline void Lexer::swapFormIds(const std::size_t offset)
+	{
+		form_id_.assign(config_.buffer.begin() + static_cast<std::ptrdiff_t>(offset), config_.buffer.end());
+		config_.buffer.resize(offset);
+
+		const std::string_view text = form_id_;
+		std::size_t position = 0;        /* First character not copied yet. */
+		std::size_t dawnguard_end = 0;   /* End of the last Dawnguard FormID. */
+		std::size_t dragonborn_end = 0;  /* End of the last Dragonborn FormID. */
+
+		for(std::size_t i = 0; i + 1 < text.size(); i++)
+		{
+			if(text[i] != '0' || (text[i + 1] != 'x' && text[i + 1] != 'X'))
+				continue;
+
+			std::size_t length = 0;
+			std::string_view master;
+			if(i >= dawnguard_end && (length = masterFormIdLength(text, i, '2')) != 0)
+			{
+				master = "~Dawnguard.esm"sv;
+				dawnguard_end = i + length;
+			}
+			// The last digit of Dawnguard FormID is followed by its plugin name, so it can't start Dragonborn FormID.
+			else if(i >= dragonborn_end && i + 1 != dawnguard_end && (length = masterFormIdLength(text, i, '4')) != 0)
+			{
+				master = "~Dragonborn.esm"sv;
+				dragonborn_end = i + length;
+			}
+			else
+				continue;
+
+			// Dawnguard FormID can start with the last digit of Dragonborn FormID that was already copied.
+			if(i >= position)
+			{
+				append(text.substr(position, i - position));
+				append("0x"sv);
+			}
+			else
+				append("x"sv);
+			append(text.substr(i + length - 6, 6));
+			append(master);
+			position = i + length;
+		}
+
+		append(text.substr(position));
+	}
+
+	inline bool Lexer::isSpace(const char c)
+	{
+		return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+	}
+
+	inline bool Lexer::isHex(const char c)
+	{
+		return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+	}
+
+	inline std::size_t Lexer::hexLength(const std::string_view text, const std::size_t position)
+	{
+		std::size_t length = 0;
+		while(position + length < text.size() && isHex(text[position + length]))
+			length++;
+		return length;
+	}
+
+	inline std::size_t Lexer::masterFormIdLength(const std::string_view text, const std::size_t position, const char index)
+	{
+		std::size_t i = position + 2;
+		while(i < text.size() && text[i] == '0')
+			i++;
+		if(i >= text.size() || text[i] != index || hexLength(text, i + 1) < 6)
+			return 0;
+		return i + 7 - position;
+	}
+}
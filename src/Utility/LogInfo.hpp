@@ -5,9 +5,9 @@
 
 namespace flm::log
 {
-	inline unsigned int indent_level = 0;                    /* Indentation level. */
-	inline bool debug_mode = false;                          /* Mode for more detailed information. */
-	inline OMode operating_mode = OperatingMode::INITIALIZE; /* Current operating mode. */
+	inline thread_local unsigned int indent_level = 0;       /* Indentation level, separate for every thread, so the background processing of configs has its own. */
+	inline std::atomic<bool> debug_mode = false;             /* Mode for more detailed information. Set by the background processing of configs, read by every thread. */
+	inline OMode operating_mode = OperatingMode::INITIALIZE; /* Current operating mode. Changed only on the main thread after configs are processed. */
 
 	/**
 	 * \brief Initialize logging for plugin.
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Utility/InsertionLog.hpp"
+
+namespace flm
+{
+	inline constexpr auto undo_suffix = "Undo"sv; /* Suffix of the Mod Event that rolls back the last application of the event. */
+
+	/**
+	 * \brief Forms inserted by every application of Mod Events, per event, so the last application can be rolled back.
+	 * Records are stored in the SKSE cosave, every transaction as blocks of FormIDs, one block per FormList.
+	 */
+	class TransactionLog
+	{
+		public:
+			static constexpr std::uint32_t record = 'FLMT'; /* Type of the cosave record. */
+			static constexpr std::uint32_t version = 1;     /* Version of the cosave record, must change when the format changes. */
+
+			/**
+			 * \brief Stores the application of the Mod Event as its last transaction. An application that inserted nothing is dropped, so Undo reverts the last one that did.
+			 * \param event                 - Name of the Mod Event.
+			 * \param transaction           - Log with Forms inserted by the application.
+			 * \return                      - True, if the transaction was stored.
+			 */
+			bool Commit(std::string_view event, InsertionLog&& transaction);
+
+			/**
+			 * \brief Rolls back the last transaction of the Mod Event. Its Forms are removed in one compaction per FormList.
+			 * \param event                 - Name of the Mod Event.
+			 * \param logs                  - Logs where removed Forms are forgotten.
+			 * \return                      - Amount of removed Forms, -1 if the Mod Event has no transactions.
+			 */
+			int Undo(std::string_view event, std::initializer_list<InsertionLog*> logs);
+
+			/**
+			 * \brief Removes all transactions.
+			 */
+			void Clear();
+
+			/**
+			 * \brief Writes all transactions to the cosave as one record.
+			 * \param serialization         - SKSE serialization interface.
+			 */
+			void Save(const SKSE::SerializationInterface* serialization) const;
+
+			/**
+			 * \brief Replaces transactions with the cosave record. FormIDs are remapped to the current load order.
+			 * \param serialization         - SKSE serialization interface, positioned at the data of the record.
+			 * \param recordVersion         - Version of the record.
+			 * \param recordLength          - Length of the record in bytes.
+			 * \return                      - True, if the record was read.
+			 */
+			bool Load(const SKSE::SerializationInterface* serialization, std::uint32_t recordVersion, std::uint32_t recordLength);
+
+		private:
+			StringMap<std::vector<InsertionLog>> transactions_; /* Transactions of Mod Events, oldest first. */
+	};
+
+	inline bool TransactionLog::Commit(const std::string_view event, InsertionLog&& transaction)
+	{
+		if(transaction.Size() == 0)
+			return false;
+
+		auto it = transactions_.find(event);
+		if(it == transactions_.end())
+			it = transactions_.emplace(std::string(event), std::vector<InsertionLog>{}).first;
+		it->second.push_back(std::move(transaction));
+		return true;
+	}
+
+	inline int TransactionLog::Undo(const std::string_view event, const std::initializer_list<InsertionLog*> logs)
+	{
+		const auto it = transactions_.find(event);
+		if(it == transactions_.end() || it->second.empty())
+			return -1;
+
+		const int removed = it->second.back().Undo(logs);
+		it->second.pop_back();
+		return removed;
+	}
+
+	inline void TransactionLog::Clear()
+	{
+		transactions_.clear();
+	}
+
+	inline void TransactionLog::Save(const SKSE::SerializationInterface* serialization) const
+	{
+		if(!serialization->OpenRecord(record, version))
+		{
+			log::Error("Unable to open the cosave record for Mod Event transactions.");
+			return;
+		}
+
+		bool written = serialization->WriteRecordData(static_cast<std::uint32_t>(transactions_.size()));
+		for(const auto& [event, transactions] : transactions_)
+		{
+			written = written &&
+					  serialization->WriteRecordData(static_cast<std::uint32_t>(event.size())) &&
+					  serialization->WriteRecordData(event.data(), static_cast<std::uint32_t>(event.size())) &&
+					  serialization->WriteRecordData(static_cast<std::uint32_t>(transactions.size()));
+			for(const auto& transaction : transactions)
+				written = written && transaction.Write(serialization);
+		}
+
+		if(!written)
+			log::Error("Unable to write Mod Event transactions to the cosave.");
+	}
+
+	inline bool TransactionLog::Load(const SKSE::SerializationInterface* serialization, const std::uint32_t recordVersion, std::uint32_t recordLength)
+	{
+		Clear();
+		if(recordVersion != version)
+		{
+			log::Warn("Unsupported version {} of Mod Event transactions in the cosave, skipping.", recordVersion);
+			return false;
+		}
+
+		const auto read_count = [serialization, &recordLength](std::uint32_t& count)
+		{
+			if(recordLength < sizeof(count) || !serialization->ReadRecordData(count))
+				return false;
+			recordLength -= sizeof(count);
+			return true;
+		};
+
+		std::uint32_t events_count = 0;
+		if(!read_count(events_count))
+			return false;
+
+		std::string event;
+		for(std::uint32_t i = 0; i < events_count; i++)
+		{
+			std::uint32_t length = 0;
+			std::uint32_t transactions_count = 0;
+			if(!read_count(length) || length > recordLength)
+			{
+				Clear();
+				return false;
+			}
+
+			event.resize(length);
+			if(length != 0 && serialization->ReadRecordData(event.data(), length) != length)
+			{
+				Clear();
+				return false;
+			}
+			recordLength -= length;
+
+			// Every transaction starts with two counts, so a corrupted amount is caught before memory for it is allocated.
+			if(!read_count(transactions_count) || std::uint64_t{ transactions_count } * 2 * sizeof(std::uint32_t) > recordLength)
+			{
+				log::Warn("Mod Event {} has more transactions than the cosave record holds, the record is skipped.", event);
+				Clear();
+				return false;
+			}
+
+			auto& transactions = transactions_[event];
+			transactions.resize(transactions_count);
+			for(auto& transaction : transactions)
+				if(!transaction.Read(serialization, recordLength))
+				{
+					Clear();
+					return false;
+				}
+
+			// Transactions left empty by removed plugins have nothing to undo.
+			std::erase_if(transactions, [](const InsertionLog& transaction)
+						  { return transaction.Size() == 0; });
+		}
+
+		return true;
+	}
+}
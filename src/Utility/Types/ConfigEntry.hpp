@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Types.hpp"
+
+namespace flm
+{
+	using References = std::span<const std::string_view>; /* Comma separated parts of a section, e.g. Form references. */
+
+	/**
+	 * \brief Part of the entry between | separators.
+	 */
+	struct Section
+	{
+		std::string_view text; /* Whole section. */
+		References references; /* Section split by commas. */
+	};
+
+	using Sections = std::span<const Section>; /* Sections of an entry. */
+
+	/**
+	 * \brief Single entry from a config file, tokenized once and reused by every processing pass.
+	 * All views point into the buffer of the config file that owns the entry.
+	 */
+	struct ConfigEntry
+	{
+		EntryType::EntryType type = EntryType::ALL; /* Kind of the entry. ALL if the key is unknown. */
+		int line = 0;                                /* Position of the entry in the config file. */
+		std::string_view key;                        /* Key as written in the config file. */
+		std::string_view value;                      /* Sanitized value. */
+		Sections sections;                           /* Sanitized value split into sections. */
+	};
+
+	/**
+	 * \brief Config file with all its entries. Owns the buffer with sanitized text of all entries.
+	 */
+	struct ConfigFile
+	{
+		std::string path;                         /* Path to the config file. */
+		std::uint64_t hash = 0;                   /* Hash of the bytes of the config file. */
+		bool loaded = false;                      /* True, if the file was read successfully. */
+		bool cached = false;                      /* True, if the tokens were restored from the cache. */
+		std::vector<char> buffer;                 /* Keys and sanitized values of all entries. */
+		std::vector<std::string_view> references; /* References of all sections. */
+		std::vector<Section> sections;            /* Sections of all entries. */
+		std::vector<ConfigEntry> entries;         /* All entries from the file, in processing order. */
+
+		ConfigFile() = default;
+		explicit ConfigFile(std::string path) :
+			path(std::move(path)) {}
+
+		// Entries keep views into the buffer, moving keeps them valid, copying would not.
+		ConfigFile(const ConfigFile&) = delete;
+		ConfigFile(ConfigFile&&) = default;
+		ConfigFile& operator=(const ConfigFile&) = delete;
+		ConfigFile& operator=(ConfigFile&&) = default;
+	};
+
+	using ConfigFiles = std::vector<ConfigFile>; /* Vector of config files. */
+
+	/**
+	 * \brief Definition of a named Group or Alias. It is resolved on first use, exactly once.
+	 */
+	struct Definition
+	{
+		enum class State
+		{
+			DEFINED,   /* Not resolved yet. */
+			RESOLVING, /* Being resolved, using it again means a cycle. */
+			RESOLVED   /* Resolved. */
+		};
+
+		References references;        /* References from the definition entry. */
+		State state = State::DEFINED; /* State of the resolution. */
+	};
+}
@@ -13,6 +13,8 @@ namespace flm::EntryType
 		FILTR,     /* Filters. */
 		MODEV,     /* Mod events. */
 		FLIST,     /* FromList. */
+		FLREM,     /* Forms removed from FromList. */
+		MEREM,     /* Mod events that remove Forms. */
 		PLANT,     /* Plant. */
 		BTOYS,     /* Boy's toys. */
 		GTOYS,     /* Girl's toys. */
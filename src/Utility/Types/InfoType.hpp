@@ -31,8 +31,13 @@ namespace flm::InfoType
 		FORMS,      /* Total amount of found Forms during configs parse. */
 		FORMS_MISS, /* Total amount of missing Forms. */
 
+		FORMS_REP, /* Total amount of repeated Forms removed from FormLists payloads. */
+
 		FORMS_ADD, /* Total amount of added Forms. */
-		FORMS_DUP, /* Total amount of Forms duplicates. */
+		FORMS_DUP, /* Total amount of Forms already on FormLists. Forms repeated in payloads are dropped when parsing and counted in FORMS_REP. */
+
+		FORMS_REM,     /* Total amount of removed Forms. */
+		FORMS_REM_MIS, /* Total amount of Forms to remove that were not on FormLists. */
 
 		PLANTS_ADD, /* Total amount of added Plants. */
 		PLANTS_DUP, /* Total amount of Plants duplicates. */
@@ -55,9 +60,16 @@ namespace flm::InfoType
 		DSREC_ADD, /* Total amount of added recipes and results to Dragonborn Spider Crafting. */
 		DSREC_DUP, /* Total amount of recipes and results duplicates to Dragonborn Spider Crafting. */
 
+		PAIRS_MISAL, /* How many pairs of parallel FormLists are not aligned. */
+
 		MODEV,     /* Total amount of added Mod Events. */
 		MODEV_INV, /* Total amount of invalid Mod Events. */
 
+		RESOLVE_HIT,  /* How many Form references were resolved from the cache. */
+		RESOLVE_MISS, /* How many Form references had to be looked up. */
+
+		RELOAD_CHK, /* How many Forms inserted by FLM were checked after new game or load. */
+
 		ALL /* Amount of Entry types. */
 	};
 }
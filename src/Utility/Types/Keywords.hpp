@@ -4,19 +4,73 @@
 
 namespace flm
 {
-	inline std::array<std::string, EntryType::ALL> keywords{
-		"alias",                    /* Aliases for FormLists. */
-		"group",                    /* Groups for Forms. */
-		"collection",               /* Collections for Forms with specific keyword. */
-		"filter",                   /* Filters for Entries. */
-		"modevent",                 /* Mod events. */
-		"formlist",                 /* FromList. */
-		"plant",                    /* Plant. */
-		"btoys",                    /* Boy's toys. */
-		"gtoys",                    /* Girl's toys. */
-		"haircolors",               /* Hair colors. */
-		"atronachforge",            /* Atronach forge. */
-		"atronachforgesigil",       /* Atronach forge with Sigil Stone. */
-		"dragonbornspidercrafting", /* Dragonborn Spider Crafting. */
-	};                              /* Types of the keywords used in config files. */
+	inline constexpr std::array<std::string_view, EntryType::ALL> keywords{
+		"alias"sv,                    /* Aliases for FormLists. */
+		"group"sv,                    /* Groups for Forms. */
+		"collection"sv,               /* Collections for Forms with specific keyword. */
+		"filter"sv,                   /* Filters for Entries. */
+		"modevent"sv,                 /* Mod events. */
+		"formlist"sv,                 /* FromList. */
+		"formlistremove"sv,           /* Forms removed from FromList. */
+		"modeventremove"sv,           /* Mod events that remove Forms. */
+		"plant"sv,                    /* Plant. */
+		"btoys"sv,                    /* Boy's toys. */
+		"gtoys"sv,                    /* Girl's toys. */
+		"haircolors"sv,               /* Hair colors. */
+		"atronachforge"sv,            /* Atronach forge. */
+		"atronachforgesigil"sv,       /* Atronach forge with Sigil Stone. */
+		"dragonbornspidercrafting"sv, /* Dragonborn Spider Crafting. */
+	};                                /* Types of the keywords used in config files. */
+
+	/**
+	 * \brief Hashes the key with FNV-1a, mixed at the end so the low bits depend on the whole seed. Not case-sensitive.
+	 * \param key           - Key to hash.
+	 * \param seed          - Seed mixed into the offset basis.
+	 * \return              - Hash of the key.
+	 */
+	constexpr std::uint32_t HashKey(const std::string_view key, const std::uint32_t seed)
+	{
+		std::uint32_t hash = 2166136261u ^ seed;
+		for(const char c : key)
+		{
+			hash ^= static_cast<unsigned char>(c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c);
+			hash *= 16777619u;
+		}
+
+		hash ^= hash >> 16;
+		hash *= 0x85EBCA6Bu;
+		hash ^= hash >> 13;
+		return hash;
+	}
+
+	/**
+	 * \brief Perfect hash table of the keywords, every keyword has its own slot.
+	 */
+	struct KeyTable
+	{
+		static constexpr std::size_t size = 32; /* Amount of slots, power of two. */
+
+		std::uint32_t seed = 0;                        /* Seed without collisions between keywords. */
+		std::array<EntryType::EntryType, size> types{}; /* Type of the keyword in every slot, ALL for empty slots. */
+	};
+
+	/* Perfect hash table of the keywords, the seed is searched at compile time. */
+	inline constexpr KeyTable key_table = []
+	{
+		KeyTable table;
+		for(;; table.seed++)
+		{
+			table.types.fill(EntryType::ALL);
+			bool collision = false;
+			for(std::size_t type = 0; type < keywords.size() && !collision; type++)
+			{
+				auto& slot = table.types[HashKey(keywords[type], table.seed) & (KeyTable::size - 1)];
+				collision = slot != EntryType::ALL;
+				slot = static_cast<EntryType::EntryType>(type);
+			}
+
+			if(!collision)
+				return table;
+		}
+	}();
 }
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "Types.hpp"
+
+namespace flm
+{
+	using SymbolId = std::uint32_t; /* Dense ID of an interned name. */
+
+	/**
+	 * \brief Interns names of Aliases, Groups, Collections and Filters. Each name gets a dense ID once, at parse time.
+	 */
+	class SymbolTable
+	{
+		public:
+			static constexpr SymbolId none = std::numeric_limits<SymbolId>::max(); /* ID of a name that was never interned. */
+
+			/**
+			 * \brief Returns the ID of the name, adds the name if it is new.
+			 * \param name                  - Name to intern. Case-sensitive.
+			 * \return                      - ID of the name.
+			 */
+			SymbolId Intern(std::string_view name);
+
+			/**
+			 * \brief Returns the ID of the name without adding it.
+			 * \param name                  - Name to find. Case-sensitive.
+			 * \return                      - ID of the name, none if the name was never interned.
+			 */
+			[[nodiscard]] SymbolId Find(std::string_view name) const;
+
+			/**
+			 * \brief Returns the name with the ID.
+			 * \param id                    - ID of the name.
+			 * \return                      - Interned name.
+			 */
+			[[nodiscard]] std::string_view Name(SymbolId id) const;
+
+		private:
+			std::deque<std::string> names_; /* Names indexed by ID. Deque keeps the views in ids_ valid. */
+			StringViewMap<SymbolId> ids_;   /* Name - ID. */
+	};
+
+	/**
+	 * \brief Flat storage of values indexed by IDs from SymbolTable.
+	 * \tparam T                            - Type of the value.
+	 */
+	template<class T>
+	class SymbolMap
+	{
+		public:
+			/**
+			 * \brief Checks whether the value with the ID is defined.
+			 * \param id                    - ID of the name.
+			 * \return                      - True, if the value is defined.
+			 */
+			[[nodiscard]] bool Contains(SymbolId id) const;
+
+			/**
+			 * \brief Returns the value with the ID.
+			 * \param id                    - ID of the name.
+			 * \return                      - Pointer to the value, nullptr if the value is not defined.
+			 */
+			[[nodiscard]] T* Find(SymbolId id);
+			[[nodiscard]] const T* Find(SymbolId id) const;
+
+			/**
+			 * \brief Returns the value with the ID, defines an empty value if it is not defined.
+			 * \param id                    - ID of the name.
+			 * \return                      - Reference to the value.
+			 */
+			T& operator[](SymbolId id);
+
+			/**
+			 * \brief Removes the value with the ID.
+			 * \param id                    - ID of the name.
+			 */
+			void Erase(SymbolId id);
+
+			/**
+			 * \brief Returns the amount of defined values.
+			 * \return                      - Amount of defined values.
+			 */
+			[[nodiscard]] std::size_t Size() const;
+
+			/**
+			 * \brief Returns IDs of defined values, in order of definition.
+			 * \return                      - IDs of defined values.
+			 */
+			[[nodiscard]] const std::vector<SymbolId>& Ids() const;
+
+		private:
+			std::vector<T> values_;     /* Values indexed by ID. */
+			std::vector<bool> defined_; /* Defined values indexed by ID. */
+			std::vector<SymbolId> ids_; /* IDs of defined values, in order of definition. */
+	};
+
+	inline SymbolId SymbolTable::Intern(const std::string_view name)
+	{
+		if(const auto it = ids_.find(name); it != ids_.end())
+			return it->second;
+
+		const auto id = static_cast<SymbolId>(names_.size());
+		ids_.emplace(names_.emplace_back(name), id);
+		return id;
+	}
+
+	inline SymbolId SymbolTable::Find(const std::string_view name) const
+	{
+		const auto it = ids_.find(name);
+		return it != ids_.end() ? it->second : none;
+	}
+
+	inline std::string_view SymbolTable::Name(const SymbolId id) const
+	{
+		return names_[id];
+	}
+
+	template<class T>
+	inline bool SymbolMap<T>::Contains(const SymbolId id) const
+	{
+		return id < defined_.size() && defined_[id];
+	}
+
+	template<class T>
+	inline T* SymbolMap<T>::Find(const SymbolId id)
+	{
+		return Contains(id) ? &values_[id] : nullptr;
+	}
+
+	template<class T>
+	inline const T* SymbolMap<T>::Find(const SymbolId id) const
+	{
+		return Contains(id) ? &values_[id] : nullptr;
+	}
+
+	template<class T>
+	inline T& SymbolMap<T>::operator[](const SymbolId id)
+	{
+		if(id >= values_.size())
+		{
+			values_.resize(id + 1);
+			defined_.resize(id + 1, false);
+		}
+
+		if(!defined_[id])
+		{
+			defined_[id] = true;
+			ids_.push_back(id);
+		}
+
+		return values_[id];
+	}
+
+	template<class T>
+	inline void SymbolMap<T>::Erase(const SymbolId id)
+	{
+		if(!Contains(id))
+			return;
+
+		values_[id] = T{};
+		defined_[id] = false;
+		std::erase(ids_, id);
+	}
+
+	template<class T>
+	inline std::size_t SymbolMap<T>::Size() const
+	{
+		return ids_.size();
+	}
+
+	template<class T>
+	inline const std::vector<SymbolId>& SymbolMap<T>::Ids() const
+	{
+		return ids_;
+	}
+}
@@ -32,14 +32,17 @@ namespace flm
 	template <class K>
 	using Set = ankerl::unordered_dense::segmented_set<K>;
 
-	using ParseEntryCallback = std::function<bool(const std::string&)>;                      /* Pointer to the function that parses the entry. */
+	using Strings = std::vector<std::string>;                                                /* Vector of strings.*/
 	using Forms = std::vector<RE::TESForm*>;                                                 /* Vector of pointers to TESForms. */
-	using MapForms = StringMap<Forms>;                                                       /* Map with Vectors of pointers to TESForms. */
-	using FormListsData = std::map<RE::BGSListForm*, Forms>;                                 /* Data for mod events. */
+	using SharedForms = std::shared_ptr<const Forms>;                                        /* Immutable Forms shared by all entries that use them. */
+	using FormSets = std::vector<SharedForms>;                                               /* Shared sets of Forms, in order of adding. */
+	using FormIds = std::vector<RE::FormID>;                                                 /* Vector of FormIDs. */
+	using FormListsSets = std::map<RE::BGSListForm*, FormSets>;                              /* Parsed Forms for FormLists, before finalization. */
+	using FormListsData = std::map<RE::BGSListForm*, FormIds>;                               /* Unique FormIDs for FormLists, in order of adding. */
 	using MapModEvents = StringMap<FormListsData>;                                           /* Mod events type. */
+	using MapModEventsSets = StringMap<FormListsSets>;                                       /* Parsed Mod events, before finalization. */
 	using FormPair = std::pair<RE::TESForm*, RE::TESForm*>;                                  /* Pair of Forms*. */
 	using FormsLists = std::vector<RE::BGSListForm*>;                                        /* Vector of pointers to BGSListForm. */
-	using FormsPairs = std::vector<FormPair>;                                                /* Vector of FormPair. */
 	using StringViewPair = std::pair<std::string_view, std::string_view>;                    /* Pair of string views. */
 	using PairEntryNames = std::tuple<std::string_view, std::string_view, std::string_view>; /* Names for pair entry: entry, first element, second element. */
 	using Flt = FormListType::FormListType;                                                  /* Form list type. */
@@ -51,10 +54,15 @@ namespace flm
 	using Keywords = std::vector<RE::BGSKeyword*>;                                           /* Vector of keywords.*/
 	using KeywordsPairVec = std::pair<Keywords, Keywords>;                                   /* Pair of Vectors of Keywords.*/
 	using MapKeywords = StringViewMap<RE::BGSKeyword*>;                                      /* For EditorID - keyword. */
-	using StringMapSet = StringMap<StringSet>;                                               /* Map of name - set. */
 
-	namespace ift = InfoType; /* InfoType namespace short alias. */
+	/**
+	 * \brief Pairs of Forms for two parallel FormLists, stored as two parallel arrays of FormIDs.
+	 */
+	struct FormIdPairs
+	{
+		FormIds first;  /* FormIDs of first Forms. */
+		FormIds second; /* FormIDs of second Forms, parallel to first. */
+	};
 
-	using Strings = std::vector<std::string>;                                                /* Vector of strings.*/
-	using CollectionData = StringMap<KeywordsPairVec>;                                       /* Pair Collection name - keywords.*/
+	namespace ift = InfoType; /* InfoType namespace short alias. */
 }
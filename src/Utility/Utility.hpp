@@ -1,6 +1,13 @@
 #pragma once
 
 #include "MergeMapperPluginAPI.h"
+#include "Utility/ConfigCache.hpp"
+#include "Utility/ConfigDiscovery.hpp"
+#include "Utility/FormListIndex.hpp"
+#include "Utility/InsertionLog.hpp"
+#include "Utility/KeywordIndex.hpp"
+#include "Utility/Lexer.hpp"
+#include "Utility/TransactionLog.hpp"
 #include "Utility/LogInfo.hpp"
 #include "Utility/Types/Types.hpp"
 
@@ -12,7 +19,7 @@ namespace flm
 	 * \param rawFormId     - FormID of the record.
 	 * \return              - Form (TESForm) pointer or nullptr if not found.
 	 */
-	inline RE::TESForm* GetTesForm(const std::string& pluginName, const std::uint32_t rawFormId)
+	inline RE::TESForm* GetTesForm(const std::string_view pluginName, const std::uint32_t rawFormId)
 	{
 		static const auto data_handler = RE::TESDataHandler::GetSingleton();
 		return data_handler ? data_handler->LookupForm(rawFormId, pluginName) : nullptr;
@@ -48,12 +55,12 @@ namespace flm
 	 * \return              - FormList pointer or nullptr if not found.
 	 */
 	template<typename T = RE::TESForm>
-	inline T* FindForm(const std::string& string)
+	inline T* FindForm(const std::string_view string)
 	{
-		if(string.find("~"sv) != std::string::npos)
+		if(const auto tilde = string.find('~'); tilde != std::string_view::npos)
 		{
-			auto split_id = string::split(string, "~");
-			auto [plugin, form_id_str] = std::make_pair(split_id.at(1), split_id.at(0));
+			auto plugin = std::string(string.substr(tilde + 1, string.find('~', tilde + 1) - tilde - 1));
+			auto form_id_str = std::string(string.substr(0, tilde));
 			if(form_id_str.size() == 10)
 				form_id_str.erase(2, 2);
 			auto form_id = string::to_num<RE::FormID>(form_id_str, true);
@@ -74,15 +81,15 @@ namespace flm
 				return nullptr;
 			}
 		}
-		else if(string.find("0x"sv) != std::string::npos)
+		else if(string.find("0x"sv) != std::string_view::npos)
 		{
-			if(const auto f = RE::TESForm::LookupByID(string::to_num<RE::FormID>(string, true)))
+			if(const auto f = RE::TESForm::LookupByID(string::to_num<RE::FormID>(std::string(string), true)))
 				return f->As<T>();
 			if(log::operating_mode == OperatingMode::INITIALIZE && log::debug_mode)
 				log::Error("Can't find Form with FormID {}.", string);
 			return nullptr;
 		}
-		if(const auto f = RE::TESForm::LookupByEditorID(string))
+		if(const auto f = editor_ids.Built() ? editor_ids.Find(string) : RE::TESForm::LookupByEditorID(string))
 			return f->As<T>();
 
 		if(log::operating_mode == OperatingMode::INITIALIZE && log::debug_mode)
@@ -90,38 +97,6 @@ namespace flm
 		return nullptr;
 	}
 
-	/**
-	 * \brief Removes spaces between | , and leading zeros from string. From https://github.com/powerof3/Spell-Perk-Item-Distributor.
-	 * \param string        - String to parse.
-	 * \return              - Sanitized string.
-	 */
-	inline std::string Sanitize(const std::string& string)
-	{
-		std::string sanitized = string;
-
-		// strip spaces between " | "
-		static const boost::regex re_bar(R"(\s*\|\s*)", boost::regex_constants::optimize);
-		sanitized = regex_replace(sanitized, re_bar, "|");
-
-		// strip spaces between " , "
-		static const boost::regex re_comma(R"(\s*,\s*)", boost::regex_constants::optimize);
-		sanitized = regex_replace(sanitized, re_comma, ",");
-
-		// strip leading zeros
-		static const boost::regex re_zeros(R"((0x00+)([0-9a-fA-F]+))", boost::regex_constants::optimize);
-		sanitized = regex_replace(sanitized, re_zeros, "0x$2");
-
-		// swap dawnguard and dragonborn forms
-		// VR apparently does not load masters in order so the lookup fails
-		static const boost::regex re_dawnguard(R"((0x0*2)([0-9a-f]{6}))", static_cast<int>(boost::regex_constants::optimize) | static_cast<int>(boost::regex::icase));
-		sanitized = regex_replace(sanitized, re_dawnguard, "0x$2~Dawnguard.esm");
-
-		static const boost::regex re_dragonborn(R"((0x0*4)([0-9a-f]{6}))", static_cast<int>(boost::regex_constants::optimize) | static_cast<int>(boost::regex::icase));
-		sanitized = regex_replace(sanitized, re_dragonborn, "0x$2~Dragonborn.esm");
-
-		return sanitized;
-	}
-
 	/**
 	 * \brief Change string to make all characters lowercase.
 	 * \param string        - String to change.
@@ -133,37 +108,109 @@ namespace flm
 	}
 
 	/**
-	 * \brief Removes spaces between , for Filters.
-	 * \param string        - Filter to parse.
-	 * \return              - Sanitized Filter.
+	 * \brief Check if string contains non alpha character.
+	 * \param string        - String to check.
+	 * \return              - True, if string contains at least one non alpha character.
+	 */
+	inline bool ContainsNonAlpha(const std::string_view string)
+	{
+		return std::ranges::find_if(string, [](const unsigned char c)
+									{ return !std::isalpha(c); }) != string.end();
+	}
+
+	/**
+	 * \brief Reads config file and tokenizes all its entries, so the file is read and sanitized only once.
+	 * Tokens of files that have not changed since the last launch are restored from the cache instead.
+	 * \param path          - Path to the config file.
+	 * \param cache         - Cache with tokens from the last launch.
+	 * \return              - Config file with tokenized entries. Not loaded if the file can't be read.
 	 */
-	inline std::string SanitizeFilter(const std::string& string)
+	inline ConfigFile LoadConfig(const std::string& path, const ConfigCache& cache)
 	{
-		std::string sanitized = string;
+		ConfigFile config{ path };
 
-		// strip spaces between " , "
-		static const boost::regex re_comma(R"(\s*,\s*)", boost::regex_constants::optimize);
-		sanitized = regex_replace(sanitized, re_comma, ",");
-		ToLower(sanitized);
-		return sanitized;
+		std::ifstream file(path, std::ios::binary);
+		if(!file)
+			return config;
+		const std::string bytes{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+		config.hash = ConfigCache::Hash(bytes);
+		if(cache.Restore(config))
+			return config;
+
+		CSimpleIniA ini;
+		ini.SetUnicode();
+		ini.SetMultiKey();
+
+		if(const auto rc = ini.LoadData(bytes.data(), bytes.size()); rc < 0)
+			return config;
+
+		config.loaded = true;
+
+		if(const auto values = ini.GetSection(""); values)
+		{
+			std::size_t capacity = 0;
+			for(const auto& [key, value] : *values)
+				capacity += std::strlen(key.pItem) + std::strlen(value);
+
+			config.entries.reserve(values->size());
+			Lexer lexer(config, capacity);
+			for(const auto& [key, value] : *values)
+				lexer.Tokenize(key.pItem, value, key.nOrder);
+			lexer.Finish();
+		}
+
+		return config;
 	}
 
 	/**
-	 * \brief Check if string contains non alpha character.
-	 * \param string        - String to check.
-	 * \return              - True, if string contains at least one non alpha character.
+	 * \brief Forms of one FormList, prepared to be appended.
 	 */
-	inline bool ContainsNonAlpha(const std::string& string)
+	struct PreparedFormList
 	{
-		return std::ranges::find_if(string, [](char c)
-									{ return !std::isalpha(c); }) != string.end();
+		RE::BGSListForm* list = nullptr;                     /* FormList where Forms will be added. */
+		const FormIds* form_ids = nullptr;                   /* FormIDs of Forms to add. */
+		std::optional<FormListIndex> index;                  /* Index of the FormList with accepted Forms. */
+		int duplicates = 0;                                  /* Amount of Forms already on the FormList. */
+		bool trace = false;                                  /* If True, every Form is recorded in sequence, so it can be logged. */
+		std::vector<std::pair<RE::TESForm*, bool>> sequence; /* Forms in order of the config with true for duplicates, filled only if trace is set. */
+	};
+
+	/**
+	 * \brief Collects Forms of the FormList and accepts Forms that are not on it yet. Only reads game data, so FormLists are prepared concurrently.
+	 * \param prepared          - FormList with FormIDs to prepare.
+	 */
+	inline void PrepareFormList(PreparedFormList& prepared)
+	{
+		auto& index = prepared.index.emplace(prepared.list);
+		for(const auto form_id : *prepared.form_ids)
+		{
+			// Forms already on the list are skipped by FormID, without looking them up.
+			if(index.Contains(form_id))
+			{
+				prepared.duplicates++;
+				if(prepared.trace)
+					if(const auto f = RE::TESForm::LookupByID(form_id))
+						prepared.sequence.emplace_back(f, true);
+				continue;
+			}
+
+			if(const auto f = RE::TESForm::LookupByID(form_id))
+			{
+				index.Add(f);
+				if(prepared.trace)
+					prepared.sequence.emplace_back(f, false);
+			}
+		}
 	}
 
 	/**
 	 * \brief Adds correct generic entries with forms to the game.
-	 * \param data              - A map containing FromLists with their corresponding Forms.
+	 * FormLists are independent, so they are prepared on worker threads. They are modified and logged on the calling thread, in order of the map.
+	 * \param data              - A map containing FromLists with FormIDs of their corresponding Forms.
+	 * \param inserted          - Log where added Forms are recorded, nullptr if they are not recorded.
 	 */
-	inline std::pair<int, int> AddGeneric(FormListsData& data)
+	inline std::pair<int, int> AddGeneric(FormListsData& data, InsertionLog* inserted = nullptr)
 	{
 		if(log::operating_mode == OperatingMode::INITIALIZE)
 		{
@@ -174,43 +221,52 @@ namespace flm
 		int total_duplicates = 0;
 		int total_added = 0;
 
-		for(auto& [form_list, forms] : data)
+		const bool trace = log::operating_mode == OperatingMode::INITIALIZE && log::debug_mode;
+		std::vector<PreparedFormList> prepared(data.size());
+		auto it = prepared.begin();
+		for(auto& [form_list, form_ids] : data)
+		{
+			it->list = form_list;
+			it->form_ids = &form_ids;
+			it->trace = trace;
+			++it;
+		}
+		std::for_each(std::execution::par, prepared.begin(), prepared.end(), PrepareFormList);
+
+		for(auto& [fl, form_ids, index, duplicates, list_trace, sequence] : prepared)
 		{
-			int duplicates = 0;
-			int added = 0;
-			RE::BGSListForm* fl = form_list;
+			const auto& added = index->Pending();
 			if(log::operating_mode == OperatingMode::INITIALIZE)
 			{
 				log::Info("FormList {} \"{}\" [{:X}]", GetEditorId(fl), fl->GetName(), fl->formID);
 				log::indent_level++;
-			}
 
-			for(const auto& f : forms)
-			{
-				if(fl->HasForm(f))
+				// Duplicates and added Forms are logged interleaved, in order of the config.
+				for(const auto& [f, duplicate] : sequence)
 				{
-					if(log::operating_mode == OperatingMode::INITIALIZE && log::debug_mode)
+					if(duplicate)
 						log::DuplicateWarn("Form"sv, f);
-					duplicates++;
-					continue;
-				}
-				else
-				{
-					fl->AddForm(f);
-					added++;
-					if(log::debug_mode && log::operating_mode == OperatingMode::INITIALIZE)
+					else
 						log::Added("Form", f);
 				}
 			}
 
+			if(inserted)
+				for(const auto f : added)
+					inserted->Record(fl, f, ift::FORMS_ADD);
+
+			const int added_count = static_cast<int>(added.size());
+			const int duplicates_count = duplicates;
+			index->Apply();
+
 			if(log::operating_mode == OperatingMode::INITIALIZE)
 			{
-				log::Info("{} new Forms added, skipped {} duplicates.", added, duplicates);
+				log::Info("{} new Forms added, skipped {} duplicates.", added_count, duplicates_count);
 				log::indent_level--;
 			}
 
-			total_added += added;
-			total_duplicates += duplicates;
+			total_added += added_count;
+			total_duplicates += duplicates_count;
 		}
 
 		if(log::operating_mode == OperatingMode::INITIALIZE)
@@ -223,6 +279,51 @@ namespace flm
 		return std::make_pair(total_added, total_duplicates);
 	}
 
+	/**
+	 * \brief Removes correct generic entries with forms from the game. Every FormList is compacted once, whatever the amount of removed Forms.
+	 * \param data              - A map containing FromLists with FormIDs of Forms to remove.
+	 * \param inserted          - Logs where removed Forms are forgotten, so they are not added again after a new game or load.
+	 * \return                  - Amount of removed Forms and amount of Forms that were not on the FormLists.
+	 */
+	inline std::pair<int, int> RemoveGeneric(const FormListsData& data, const std::initializer_list<InsertionLog*> inserted = {})
+	{
+		if(data.empty())
+			return {};
+
+		if(log::operating_mode == OperatingMode::INITIALIZE)
+		{
+			log::Header("FORMLISTS - REMOVE"sv);
+			log::indent_level++;
+		}
+
+		int total_removed = 0;
+		int total_missing = 0;
+
+		for(const auto& [fl, form_ids] : data)
+		{
+			const Set<RE::FormID> remove(form_ids.begin(), form_ids.end());
+			const int removed = RemoveForms(fl, remove);
+			const int missing = std::max(static_cast<int>(form_ids.size()) - removed, 0);
+			for(const auto log : inserted)
+				log->Forget(fl, remove);
+
+			if(log::operating_mode == OperatingMode::INITIALIZE)
+				log::Info("FormList {} \"{}\" [{:X}], {} Forms removed, {} were not on the FormList.", GetEditorId(fl), fl->GetName(), fl->formID, removed, missing);
+
+			total_removed += removed;
+			total_missing += missing;
+		}
+
+		if(log::operating_mode == OperatingMode::INITIALIZE)
+		{
+			log::indent_level--;
+			log::Info("Total {} Forms removed from {} FormLists, {} were not on them.", total_removed, data.size(), total_missing);
+			log::Header();
+		}
+
+		return std::make_pair(total_removed, total_missing);
+	}
+
 	/**
 	 * \brief It splits the filter string into conditions.
 	 * \param filter            - Filter to split.
@@ -264,12 +365,12 @@ namespace flm
 	 * \param filter                    - Filter to evaluate in format: +/-ESP[&+-ESP], +/-ESP[&+-ESP], itd.
 	 * \return                          - 1, if Filter meet criteria, 0 if invalid, -1 if did not meet criteria.
 	 */
-	inline int EvaluateFilter(const std::string& filter)
+	inline int EvaluateFilter(const Section& filter)
 	{
-		const auto conditions_sections = string::split(filter, ",");
-
-		for(auto& cs : conditions_sections)
+		for(const auto condition : filter.references)
 		{
+			std::string cs(condition);
+			ToLower(cs);
 			const auto plugins = SplitFilterConditions(cs);
 			bool result = true;
 			for(auto& plugin : plugins)
@@ -277,7 +378,7 @@ namespace flm
 				if(plugin[0] != '+' && plugin[0] != '-')
 				{
 					if(log::debug_mode)
-						log::Warn("Filter \"{}\" has an invalid format.", filter);
+						log::Warn("Filter \"{}\" has an invalid format.", filter.text);
 					return 0;
 				}
 				else
@@ -2,6 +2,7 @@
 
 #include "Manipulator/RegisterFuncs.hpp"
 #include "Manipulator/EventManager.hpp"
+#include "Manipulator/Serialization.hpp"
 #include "MergeMapperPluginAPI.h"
 
 namespace
@@ -16,11 +17,11 @@ namespace
 		// After all the ESM/ESL/ESP plugins are loaded.
 		if(event->type == SKSE::MessagingInterface::kDataLoaded)
 		{
+			flm::editor_ids.Build();
+
             if(!flm::CheckPo3Kid())
             {
-				flm::manipulator.FindAll();
-				flm::manipulator.AddAll();
-				flm::manipulator.SendEventDone();
+				flm::manipulator.Distribute();
             }
 			else
 				flm::log::Info(("KID is installed, waiting for KID to finish distribution..."));
@@ -35,12 +36,14 @@ namespace
 		// The user has started a new game by selecting New Game at the main menu.
 		else if(event->type == SKSE::MessagingInterface::kNewGame)
 		{
+			flm::manipulator.WaitReady();
 			flm::log::SetNewGameMode();
 			flm::manipulator.AddAll();
 		}
 		// The user has loaded a saved game.
 		else if(event->type == SKSE::MessagingInterface::kPostLoadGame)
 		{
+			flm::manipulator.WaitReady();
 			flm::log::SetLoadGameMode();
 			flm::manipulator.AddAll();
 		}
@@ -92,6 +95,7 @@ extern "C" [[maybe_unused]] DLLEXPORT bool SKSEAPI SKSEPlugin_Load(const SKSE::L
 	SKSE::Init(skse);
 	SKSE::GetMessagingInterface()->RegisterListener(OnEvent);
 	SKSE::GetPapyrusInterface()->Register(papyrus::RegisterFunctions);
+	serialization::RegisterCallbacks();
 	SKSE::GetModCallbackEventSource()->AddEventSink(&flm::event_manager);
 
 	return true;